@@ -0,0 +1,464 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/*  Bench - минимальная библиотека для замера производительности (без внешних зависимостей).
+    1.  Бенчмарк - функция void(Bench::State&), в которой замеряемый код выполняется в цикле
+    while (state.keepRunning()) { ... }. Подготовку внутри цикла можно исключить из замера
+    вызовами state.pauseTiming() / state.resumeTiming().
+    2.  Число итераций подбирается автоматически так, чтобы замер длился не меньше minTime секунд.
+    Один прогон (вместе с невключенной в замер подготовкой) длится не больше maxWallTime секунд.
+    3.  Результаты выводятся в формате JSON, ход выполнения - в std::cerr.  */
+namespace Bench
+{
+    // doNotOptimize - не дает компилятору выбросить вычисление значения value.
+    template <typename T>
+    inline void doNotOptimize(const T& value) {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    // State - состояние одного запуска бенчмарка.
+    class State
+    {
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        // Длина контейнера (или другой параметр размера), с которой запущен бенчмарк.
+        size_t n;
+
+        // Оставшееся количество итераций.
+        size_t remaining;
+
+        // Время, накопленное за периоды, когда замер был включен.
+        Clock::duration elapsed{};
+
+        // Момент последнего включения замера.
+        Clock::time_point start;
+
+        bool timing = false;
+        bool started = false;
+
+        // Количество обработанных элементов за одну итерацию (по умолчанию - 1).
+        size_t itemsPerIteration = 1;
+
+        // Дополнительные величины, попадающие в отчет.
+        std::map<std::string, double> counters;
+
+        friend struct Runner;
+
+    public:
+        State(size_t n, size_t iterations) : n(n), remaining(iterations) {}
+
+        // Метод возвращает длину, с которой запущен бенчмарк.
+        size_t length() const {
+            return n;
+        }
+
+        /*  Метод показывает, нужно ли выполнить очередную итерацию.
+            Первый вызов включает замер, последний - выключает.  */
+        bool keepRunning()
+        {
+            if (!started)
+            {
+                started = true;
+                resumeTiming();
+            }
+
+            if (remaining == 0)
+            {
+                pauseTiming();
+                return false;
+            }
+
+            --remaining;
+            return true;
+        }
+
+        // Метод приостанавливает замер времени.
+        void pauseTiming()
+        {
+            if (timing)
+            {
+                elapsed += Clock::now() - start;
+                timing = false;
+            }
+        }
+
+        // Метод возобновляет замер времени.
+        void resumeTiming()
+        {
+            if (!timing)
+            {
+                timing = true;
+                start = Clock::now();
+            }
+        }
+
+        // Метод задает количество элементов, обрабатываемых за одну итерацию.
+        void setItemsPerIteration(size_t items) {
+            itemsPerIteration = items;
+        }
+
+        // Метод добавляет в отчет величину name.
+        void setCounter(const std::string& name, double value) {
+            counters[name] = value;
+        }
+
+        // Метод возвращает время замера в секундах.
+        double seconds() const {
+            return std::chrono::duration<double>(elapsed).count();
+        }
+    };
+
+    // Benchmark - зарегистрированный бенчмарк.
+    struct Benchmark
+    {
+        std::string operation;
+        std::string container;
+        std::string element;
+        size_t n;
+        std::function<void(State&)> body;
+
+        // Фиксированное число итераций (0 - подбирается автоматически по minTime).
+        size_t iterations = 0;
+
+        std::string name() const {
+            return operation + "/" + container + "/" + element + "/" + std::to_string(n);
+        }
+    };
+
+    // Метод возвращает список всех зарегистрированных бенчмарков.
+    inline std::vector<Benchmark>& registry()
+    {
+        static std::vector<Benchmark> benchmarks;
+        return benchmarks;
+    }
+
+    /*  Метод регистрирует бенчмарк operation/container/element/n.
+        iterations != 0 - бенчмарк выполняется ровно iterations раз (для дорогой подготовки каждой итерации).  */
+    inline void registerBenchmark(const std::string& operation, const std::string& container,
+                                  const std::string& element, size_t n, std::function<void(State&)> body,
+                                  size_t iterations = 0)
+    {
+        registry().push_back(Benchmark{operation, container, element, n, std::move(body), iterations});
+    }
+
+    // Options - параметры командной строки.
+    struct Options
+    {
+        // Подстрока, которая должна входить в имя бенчмарка.
+        std::string filter;
+
+        // Файл для JSON-отчета (пустая строка - стандартный вывод).
+        std::string out;
+
+        // Минимальная длительность замера одного бенчмарка в секундах.
+        double minTime = 0.1;
+
+        /*  Предельная длительность одного прогона по настенным часам, включая подготовку вне замера.
+            Без нее быстрая замеряемая операция с дорогой подготовкой подбирала бы число итераций бесконечно долго.  */
+        double maxWallTime = 5.0;
+
+        // Максимальная длина контейнера.
+        size_t maxN = 10000000;
+
+        // Только вывести имена бенчмарков.
+        bool list = false;
+
+        bool help = false;
+    };
+
+    inline const char* usage()
+    {
+        return "Usage: list_benchmarks [--filter=SUBSTRING] [--max-n=N] [--min-time=SECONDS] [--max-wall-time=SECONDS] [--out=FILE] [--list]\n";
+    }
+
+    // Метод возвращает числовое значение параметра argument (или выбрасывает std::invalid_argument).
+    inline double parseNumber(const std::string& argument, const std::string& value)
+    {
+        try
+        {
+            size_t parsed = 0;
+            const double number = std::stod(value, &parsed);
+
+            if (parsed == value.size() && number >= 0) {
+                return number;
+            }
+        }
+        catch (const std::logic_error&) {}
+
+        throw std::invalid_argument("Error! Invalid value: " + argument);
+    }
+
+    // Метод разбирает аргументы командной строки. При ошибке выбрасывает std::invalid_argument.
+    inline Options parseOptions(int argc, char** argv)
+    {
+        Options options;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string argument = argv[i];
+            const size_t equals = argument.find('=');
+            const std::string key = argument.substr(0, equals);
+            const std::string value = equals == std::string::npos ? "" : argument.substr(equals + 1);
+
+            if (key == "--filter") {
+                options.filter = value;
+            }
+            else if (key == "--out") {
+                options.out = value;
+            }
+            else if (key == "--min-time") {
+                options.minTime = parseNumber(argument, value);
+            }
+            else if (key == "--max-wall-time") {
+                options.maxWallTime = parseNumber(argument, value);
+            }
+            else if (key == "--max-n") {
+                options.maxN = static_cast<size_t>(parseNumber(argument, value));
+            }
+            else if (key == "--list") {
+                options.list = true;
+            }
+            else if (key == "--help" || key == "-h") {
+                options.help = true;
+            }
+            else {
+                throw std::invalid_argument("Error! Unknown option: " + argument);
+            }
+        }
+
+        return options;
+    }
+
+    // Result - результат одного бенчмарка.
+    struct Result
+    {
+        const Benchmark* benchmark;
+        size_t iterations = 0;
+        double seconds = 0;
+        size_t itemsPerIteration = 1;
+        std::map<std::string, double> counters;
+        std::string error;
+    };
+
+    // Runner - подбирает число итераций, выполняет бенчмарки и формирует отчет.
+    struct Runner
+    {
+        // Метод экранирует строку для JSON.
+        static std::string quote(const std::string& text)
+        {
+            std::string quoted = "\"";
+
+            for (char symbol : text)
+            {
+                if (symbol == '"' || symbol == '\\') {
+                    quoted += '\\';
+                }
+
+                quoted += symbol;
+            }
+
+            return quoted + "\"";
+        }
+
+        // Метод форматирует число для JSON (бесконечность и NaN в JSON не допускаются - вместо них null).
+        static std::string number(double value)
+        {
+            if (!std::isfinite(value)) {
+                return "null";
+            }
+
+            std::ostringstream stream;
+            stream.precision(6);
+            stream << value;
+            return stream.str();
+        }
+
+        /*  Метод выполняет бенчмарк: число итераций растет, пока замер не станет длиннее minTime
+            (так же, как это делает Google Benchmark). Рост останавливается раньше, если следующий прогон
+            вместе с подготовкой вне замера длился бы дольше maxWallTime.  */
+        static Result run(const Benchmark& benchmark, double minTime, double maxWallTime)
+        {
+            using Clock = std::chrono::steady_clock;
+            constexpr size_t maxIterations = 1000000000;
+
+            Result result;
+            result.benchmark = &benchmark;
+            size_t iterations = benchmark.iterations != 0 ? benchmark.iterations : 1;
+
+            try
+            {
+                while (true)
+                {
+                    State state(benchmark.n, iterations);
+                    const Clock::time_point start = Clock::now();
+                    benchmark.body(state);
+
+                    const double wall = std::chrono::duration<double>(Clock::now() - start).count();
+                    const double seconds = state.seconds();
+
+                    // 1. Замер заметной длительности - предсказываю нужное число итераций с запасом.
+                    double multiplier = 10.0;
+
+                    if (seconds / minTime > 0.1) {
+                        multiplier = minTime * 1.4 / seconds;
+                    }
+
+                    // 2. Иначе увеличиваю число итераций в 10 раз.
+                    double next = static_cast<double>(iterations) * multiplier;
+
+                    // 3. Следующий прогон не должен длиться по настенным часам дольше maxWallTime.
+                    if (wall > 0) {
+                        next = std::min(next, static_cast<double>(iterations) * maxWallTime / wall);
+                    }
+
+                    const bool done = seconds >= minTime || iterations >= maxIterations || benchmark.iterations != 0;
+
+                    if (done || next < static_cast<double>(iterations + 1))
+                    {
+                        result.iterations = iterations;
+                        result.seconds = seconds;
+                        result.itemsPerIteration = state.itemsPerIteration;
+                        result.counters = state.counters;
+                        return result;
+                    }
+
+                    iterations = std::min(maxIterations, static_cast<size_t>(next));
+                }
+            }
+            catch (const std::exception& exception) {
+                result.error = exception.what();
+            }
+
+            return result;
+        }
+
+        static void writeJson(std::ostream& out, const std::vector<Result>& results, const Options& options)
+        {
+            const std::time_t now = std::time(nullptr);
+            char date[32];
+            std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+            out << "{\n  \"context\": {\n";
+            out << "    \"date\": " << quote(date) << ",\n";
+            out << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+            out << "    \"compiler\": " << quote(__VERSION__) << ",\n";
+#ifdef __OPTIMIZE__
+            out << "    \"optimized\": true,\n";
+#else
+            out << "    \"optimized\": false,\n";
+#endif
+            out << "    \"min_time_s\": " << number(options.minTime) << ",\n";
+            out << "    \"max_wall_time_s\": " << number(options.maxWallTime) << ",\n";
+            out << "    \"max_n\": " << options.maxN << "\n  },\n";
+            out << "  \"benchmarks\": [";
+
+            for (size_t i = 0; i < results.size(); ++i)
+            {
+                const Result& result = results[i];
+                const Benchmark& benchmark = *result.benchmark;
+
+                out << (i == 0 ? "\n" : ",\n") << "    {";
+                out << "\"name\": " << quote(benchmark.name());
+                out << ", \"operation\": " << quote(benchmark.operation);
+                out << ", \"container\": " << quote(benchmark.container);
+                out << ", \"element\": " << quote(benchmark.element);
+                out << ", \"n\": " << benchmark.n;
+
+                if (!result.error.empty())
+                {
+                    out << ", \"error\": " << quote(result.error) << "}";
+                    continue;
+                }
+
+                const double perIteration = result.seconds / static_cast<double>(result.iterations);
+                const double items = static_cast<double>(result.iterations) * static_cast<double>(result.itemsPerIteration);
+
+                out << ", \"iterations\": " << result.iterations;
+                out << ", \"real_time_ns\": " << number(perIteration * 1e9);
+                out << ", \"ns_per_item\": " << number(result.seconds * 1e9 / items);
+                out << ", \"items_per_second\": " << number(items / result.seconds);
+
+                for (const auto& counter : result.counters) {
+                    out << ", " << quote(counter.first) << ": " << number(counter.second);
+                }
+
+                out << "}";
+            }
+
+            out << "\n  ]\n}\n";
+        }
+    };
+
+    // Метод выполняет все бенчмарки, подходящие под фильтр, и выводит JSON-отчет.
+    inline int runBenchmarks(const Options& options)
+    {
+        std::vector<Result> results;
+
+        for (const Benchmark& benchmark : registry())
+        {
+            const std::string name = benchmark.name();
+
+            if (name.find(options.filter) == std::string::npos) {
+                continue;
+            }
+
+            if (options.list)
+            {
+                std::cout << name << "\n";
+                continue;
+            }
+
+            results.push_back(Runner::run(benchmark, options.minTime, options.maxWallTime));
+            const Result& result = results.back();
+
+            if (!result.error.empty()) {
+                std::cerr << name << "  ERROR: " << result.error << "\n";
+            }
+            else
+            {
+                const double items = static_cast<double>(result.iterations) * static_cast<double>(result.itemsPerIteration);
+                std::cerr << name << "  " << Runner::number(result.seconds * 1e9 / items) << " ns/item\n";
+            }
+        }
+
+        if (options.list) {
+            return 0;
+        }
+
+        if (options.out.empty()) {
+            Runner::writeJson(std::cout, results, options);
+        }
+        else
+        {
+            std::ofstream file(options.out);
+
+            if (!file)
+            {
+                std::cerr << "Error! Can't open " << options.out << "\n";
+                return 1;
+            }
+
+            Runner::writeJson(file, results, options);
+        }
+
+        return 0;
+    }
+}
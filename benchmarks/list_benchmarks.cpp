@@ -0,0 +1,2419 @@
+/*  list_benchmarks.cpp - бенчмарки контейнеров из dream.cpp в сравнении с std::list, std::forward_list и std::deque.
+    Сборка и запуск из корня репозитория:
+        g++ -std=c++17 -O2 -DNDEBUG -pthread benchmarks/list_benchmarks.cpp -o list_benchmarks
+        ./list_benchmarks --max-n=100000 --out=results.json
+    Имя бенчмарка имеет вид операция/контейнер/элемент/длина.  */
+#include "harness.hpp"
+#include "../dream.cpp"
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <forward_list>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <string>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+namespace
+{
+    // Pod64 - тривиально копируемый элемент размером 64 байта.
+    struct Pod64
+    {
+        std::uint64_t words[8];
+
+        bool operator==(const Pod64& other) const {
+            return std::equal(std::begin(words), std::end(words), std::begin(other.words));
+        }
+
+        bool operator!=(const Pod64& other) const {
+            return !(*this == other);
+        }
+
+        bool operator<(const Pod64& other) const {
+            return std::lexicographical_compare(std::begin(words), std::end(words), std::begin(other.words), std::end(other.words));
+        }
+    };
+
+    static_assert(sizeof(Pod64) == 64, "Pod64 must occupy 64 bytes");
+
+    // Метод возвращает элемент с ключом key (порядок элементов совпадает с порядком ключей).
+    template <typename T>
+    T makeValue(size_t key);
+
+    template <>
+    int makeValue<int>(size_t key) {
+        return static_cast<int>(key);
+    }
+
+    template <>
+    double makeValue<double>(size_t key) {
+        return static_cast<double>(key) + 0.5;
+    }
+
+    template <>
+    Pod64 makeValue<Pod64>(size_t key)
+    {
+        Pod64 value;
+        std::fill(std::begin(value.words), std::end(value.words), static_cast<std::uint64_t>(key));
+        return value;
+    }
+
+    // Строки длиннее буфера малых строк, чтобы каждая из них владела памятью в куче.
+    template <>
+    std::string makeValue<std::string>(size_t key)
+    {
+        std::string digits = std::to_string(key);
+        return "element-" + std::string(24 - digits.size(), '0') + digits;
+    }
+
+    template <typename T>
+    std::vector<T> makeValues(size_t n)
+    {
+        std::vector<T> values;
+        values.reserve(n);
+
+        for (size_t i = 0; i < n; ++i) {
+            values.push_back(makeValue<T>(i));
+        }
+
+        return values;
+    }
+
+    // Метод возвращает элементы с ключами 0..n-1 в случайном (но воспроизводимом) порядке.
+    template <typename T>
+    std::vector<T> makeShuffledValues(size_t n)
+    {
+        std::vector<size_t> keys(n);
+        std::iota(keys.begin(), keys.end(), size_t{0});
+        std::shuffle(keys.begin(), keys.end(), std::mt19937_64(42));
+
+        std::vector<T> values;
+        values.reserve(n);
+
+        for (size_t key : keys) {
+            values.push_back(makeValue<T>(key));
+        }
+
+        return values;
+    }
+
+    /*  Разрушающие операции выполняются над несколькими копиями контейнера за итерацию,
+        чтобы на коротких контейнерах замер не состоял из одних накладных расходов на паузу.  */
+    constexpr size_t minBatchItems = 4096;
+
+    size_t batchCount(size_t n) {
+        return std::max<size_t>(1, minBatchItems / n);
+    }
+
+    // Для контейнеров с popBack() за O(n) за одну итерацию удаляется не больше linearPopCount элементов.
+    constexpr size_t linearPopCount = 16;
+
+    // Обращение ко всем элементам подряд по индексу для контейнеров с operator[] за O(n) замеряется до этой длины.
+    constexpr size_t quadraticLimit = 10000;
+
+    /*  DreamOps - единый интерфейс операций над контейнерами из dream.cpp для бенчмарков.
+        Флаги описывают, какие операции есть у контейнера и какова их сложность.  */
+    template <typename Container, typename T>
+    struct DreamOps
+    {
+        static constexpr bool hasPushBack = true;
+        static constexpr bool hasPopBack = true;
+        static constexpr bool hasSort = false;
+        static constexpr bool hasParallelSort = false;
+
+        // Для контейнера замеряется и сортировка пузырьком, которой LinkedList::sort() был до сортировки слиянием.
+        static constexpr bool hasLegacySort = false;
+
+        // popBack() выполняется за O(n).
+        static constexpr bool linearBack = false;
+
+        // Последовательное обращение по индексу (list[0], list[1], ...) дешевле O(n) на элемент.
+        static constexpr bool cheapIndex = false;
+
+        // remove() выполняется за O(1).
+        static constexpr bool cheapRemove = false;
+
+        static void pushBack(Container& list, const T& value) {
+            list.pushBack(value);
+        }
+
+        static void pushFront(Container& list, const T& value) {
+            list.pushFront(value);
+        }
+
+        static T popFront(Container& list) {
+            return list.popFront();
+        }
+
+        static T popBack(Container& list) {
+            return list.popBack();
+        }
+
+        static bool find(const Container& list, const T& value) {
+            return list.find(value) != nullptr;
+        }
+
+        static bool contains(const Container& list, const T& value) {
+            return list.contains(value);
+        }
+
+        static bool remove(Container& list, const T& value) {
+            return list.remove(value);
+        }
+
+        static void removeAll(Container& list, const T& value) {
+            list.removeAll(value);
+        }
+
+        static const T& at(Container& list, size_t index) {
+            return list[static_cast<int>(index)];
+        }
+
+        static void sort(Container& list) {
+            list.sort();
+        }
+
+        static void clear(Container& list) {
+            list.clear();
+        }
+    };
+
+    // ContainerOps - операции контейнера Container (по умолчанию - контейнера из dream.cpp).
+    template <typename Container, typename T>
+    struct ContainerOps : DreamOps<Container, T> {};
+
+    template <typename T, typename Allocator, typename Stats, size_t N>
+    struct ContainerOps<Containers::LinkedList<T, Allocator, Stats, N>, T> : DreamOps<Containers::LinkedList<T, Allocator, Stats, N>, T>
+    {
+        static constexpr bool hasSort = true;
+        static constexpr bool hasParallelSort = true;
+        static constexpr bool hasLegacySort = true;
+        static constexpr bool linearBack = true;
+        static constexpr bool cheapIndex = true;
+    };
+
+    template <typename T, typename Allocator, size_t NodeBytes>
+    struct ContainerOps<Containers::UnrolledLinkedList<T, Allocator, NodeBytes>, T>
+        : DreamOps<Containers::UnrolledLinkedList<T, Allocator, NodeBytes>, T>
+    {
+        static constexpr bool hasSort = true;
+        static constexpr bool linearBack = true;
+    };
+
+    template <typename T, typename Allocator>
+    struct ContainerOps<Containers::IndexedLinkedList<T, Allocator>, T> : DreamOps<Containers::IndexedLinkedList<T, Allocator>, T>
+    {
+        static constexpr bool cheapIndex = true;
+    };
+
+    template <typename T, typename Hash, typename KeyEqual, typename Allocator>
+    struct ContainerOps<Containers::HashedLinkedList<T, Hash, KeyEqual, Allocator>, T>
+        : DreamOps<Containers::HashedLinkedList<T, Hash, KeyEqual, Allocator>, T>
+    {
+        static constexpr bool cheapRemove = true;
+    };
+
+    template <typename T, typename Allocator>
+    struct ContainerOps<std::list<T, Allocator>, T>
+    {
+        using Container = std::list<T, Allocator>;
+
+        static constexpr bool hasPushBack = true;
+        static constexpr bool hasPopBack = true;
+        static constexpr bool hasSort = true;
+        static constexpr bool hasParallelSort = false;
+        static constexpr bool hasLegacySort = false;
+        static constexpr bool linearBack = false;
+        static constexpr bool cheapIndex = false;
+        static constexpr bool cheapRemove = false;
+
+        static void pushBack(Container& list, const T& value) {
+            list.push_back(value);
+        }
+
+        static void pushFront(Container& list, const T& value) {
+            list.push_front(value);
+        }
+
+        static T popFront(Container& list)
+        {
+            T value = std::move(list.front());
+            list.pop_front();
+            return value;
+        }
+
+        static T popBack(Container& list)
+        {
+            T value = std::move(list.back());
+            list.pop_back();
+            return value;
+        }
+
+        static bool find(const Container& list, const T& value) {
+            return std::find(list.begin(), list.end(), value) != list.end();
+        }
+
+        static bool contains(const Container& list, const T& value) {
+            return find(list, value);
+        }
+
+        static bool remove(Container& list, const T& value)
+        {
+            auto position = std::find(list.begin(), list.end(), value);
+
+            if (position == list.end()) {
+                return false;
+            }
+
+            list.erase(position);
+            return true;
+        }
+
+        static void removeAll(Container& list, const T& value) {
+            list.remove(value);
+        }
+
+        static const T& at(Container& list, size_t index) {
+            return *std::next(list.begin(), static_cast<std::ptrdiff_t>(index));
+        }
+
+        static void sort(Container& list) {
+            list.sort();
+        }
+
+        static void clear(Container& list) {
+            list.clear();
+        }
+    };
+
+    template <typename T, typename Allocator>
+    struct ContainerOps<std::forward_list<T, Allocator>, T>
+    {
+        using Container = std::forward_list<T, Allocator>;
+
+        // У std::forward_list нет операций с концом списка.
+        static constexpr bool hasPushBack = false;
+        static constexpr bool hasPopBack = false;
+        static constexpr bool hasSort = true;
+        static constexpr bool hasParallelSort = false;
+        static constexpr bool hasLegacySort = false;
+        static constexpr bool linearBack = false;
+        static constexpr bool cheapIndex = false;
+        static constexpr bool cheapRemove = false;
+
+        static void pushFront(Container& list, const T& value) {
+            list.push_front(value);
+        }
+
+        static T popFront(Container& list)
+        {
+            T value = std::move(list.front());
+            list.pop_front();
+            return value;
+        }
+
+        static bool find(const Container& list, const T& value) {
+            return std::find(list.begin(), list.end(), value) != list.end();
+        }
+
+        static bool contains(const Container& list, const T& value) {
+            return find(list, value);
+        }
+
+        static bool remove(Container& list, const T& value)
+        {
+            for (auto previous = list.before_begin(), current = list.begin(); current != list.end(); previous = current++)
+            {
+                if (*current == value)
+                {
+                    list.erase_after(previous);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        static void removeAll(Container& list, const T& value) {
+            list.remove(value);
+        }
+
+        static const T& at(Container& list, size_t index) {
+            return *std::next(list.begin(), static_cast<std::ptrdiff_t>(index));
+        }
+
+        static void sort(Container& list) {
+            list.sort();
+        }
+
+        static void clear(Container& list) {
+            list.clear();
+        }
+    };
+
+    template <typename T, typename Allocator>
+    struct ContainerOps<std::deque<T, Allocator>, T>
+    {
+        using Container = std::deque<T, Allocator>;
+
+        static constexpr bool hasPushBack = true;
+        static constexpr bool hasPopBack = true;
+        static constexpr bool hasSort = true;
+        static constexpr bool hasParallelSort = false;
+        static constexpr bool hasLegacySort = false;
+        static constexpr bool linearBack = false;
+        static constexpr bool cheapIndex = true;
+        static constexpr bool cheapRemove = false;
+
+        static void pushBack(Container& list, const T& value) {
+            list.push_back(value);
+        }
+
+        static void pushFront(Container& list, const T& value) {
+            list.push_front(value);
+        }
+
+        static T popFront(Container& list)
+        {
+            T value = std::move(list.front());
+            list.pop_front();
+            return value;
+        }
+
+        static T popBack(Container& list)
+        {
+            T value = std::move(list.back());
+            list.pop_back();
+            return value;
+        }
+
+        static bool find(const Container& list, const T& value) {
+            return std::find(list.begin(), list.end(), value) != list.end();
+        }
+
+        static bool contains(const Container& list, const T& value) {
+            return find(list, value);
+        }
+
+        static bool remove(Container& list, const T& value)
+        {
+            auto position = std::find(list.begin(), list.end(), value);
+
+            if (position == list.end()) {
+                return false;
+            }
+
+            list.erase(position);
+            return true;
+        }
+
+        static void removeAll(Container& list, const T& value) {
+            list.erase(std::remove(list.begin(), list.end(), value), list.end());
+        }
+
+        static const T& at(Container& list, size_t index) {
+            return list[index];
+        }
+
+        // Устойчивая сортировка, как и у списков.
+        static void sort(Container& list) {
+            std::stable_sort(list.begin(), list.end());
+        }
+
+        static void clear(Container& list) {
+            list.clear();
+        }
+    };
+
+    // Метод заполняет пустой контейнер значениями values в том же порядке.
+    template <typename Container, typename T>
+    void fill(Container& list, const std::vector<T>& values)
+    {
+        using Ops = ContainerOps<Container, T>;
+
+        if constexpr (Ops::hasPushBack)
+        {
+            for (const T& value : values) {
+                Ops::pushBack(list, value);
+            }
+        }
+        else
+        {
+            for (auto it = values.rbegin(); it != values.rend(); ++it) {
+                Ops::pushFront(list, *it);
+            }
+        }
+    }
+
+    template <typename Container, typename T>
+    Container makeContainer(const std::vector<T>& values)
+    {
+        Container list;
+        fill(list, values);
+        return list;
+    }
+
+    // Метод заменяет содержимое lists на count копий prototype (вызывается при выключенном замере).
+    template <typename Container>
+    void resetCopies(std::vector<Container>& lists, size_t count, const Container& prototype)
+    {
+        lists.clear();
+        lists.reserve(count);
+
+        for (size_t i = 0; i < count; ++i) {
+            lists.emplace_back(prototype);
+        }
+    }
+
+    template <typename Container, typename T>
+    void benchPushBack(Bench::State& state)
+    {
+        using Ops = ContainerOps<Container, T>;
+
+        const size_t n = state.length();
+        const size_t copies = batchCount(n);
+        const std::vector<T> values = makeValues<T>(n);
+        std::vector<Container> lists;
+
+        while (state.keepRunning())
+        {
+            state.pauseTiming();
+            lists.clear();
+            lists.resize(copies);
+            state.resumeTiming();
+
+            for (Container& list : lists)
+            {
+                for (const T& value : values) {
+                    Ops::pushBack(list, value);
+                }
+            }
+        }
+
+        state.setItemsPerIteration(copies * n);
+    }
+
+    template <typename Container, typename T>
+    void benchPushFront(Bench::State& state)
+    {
+        using Ops = ContainerOps<Container, T>;
+
+        const size_t n = state.length();
+        const size_t copies = batchCount(n);
+        const std::vector<T> values = makeValues<T>(n);
+        std::vector<Container> lists;
+
+        while (state.keepRunning())
+        {
+            state.pauseTiming();
+            lists.clear();
+            lists.resize(copies);
+            state.resumeTiming();
+
+            for (Container& list : lists)
+            {
+                for (const T& value : values) {
+                    Ops::pushFront(list, value);
+                }
+            }
+        }
+
+        state.setItemsPerIteration(copies * n);
+    }
+
+    template <typename Container, typename T>
+    void benchPopFront(Bench::State& state)
+    {
+        using Ops = ContainerOps<Container, T>;
+
+        const size_t n = state.length();
+        const size_t copies = batchCount(n);
+        const Container prototype = makeContainer<Container>(makeValues<T>(n));
+        std::vector<Container> lists;
+
+        while (state.keepRunning())
+        {
+            state.pauseTiming();
+            resetCopies(lists, copies, prototype);
+            state.resumeTiming();
+
+            for (Container& list : lists)
+            {
+                for (size_t i = 0; i < n; ++i) {
+                    Bench::doNotOptimize(Ops::popFront(list));
+                }
+            }
+        }
+
+        state.setItemsPerIteration(copies * n);
+    }
+
+    template <typename Container, typename T>
+    void benchPopBack(Bench::State& state)
+    {
+        using Ops = ContainerOps<Container, T>;
+
+        const size_t n = state.length();
+        const size_t copies = batchCount(n);
+        const size_t pops = Ops::linearBack ? std::min(n, linearPopCount) : n;
+        const Container prototype = makeContainer<Container>(makeValues<T>(n));
+        std::vector<Container> lists;
+
+        while (state.keepRunning())
+        {
+            state.pauseTiming();
+            resetCopies(lists, copies, prototype);
+            state.resumeTiming();
+
+            for (Container& list : lists)
+            {
+                for (size_t i = 0; i < pops; ++i) {
+                    Bench::doNotOptimize(Ops::popBack(list));
+                }
+            }
+        }
+
+        state.setItemsPerIteration(copies * pops);
+    }
+
+    // Поиск последнего элемента - худший случай для последовательного поиска.
+    template <typename Container, typename T>
+    void benchFind(Bench::State& state)
+    {
+        using Ops = ContainerOps<Container, T>;
+
+        const size_t n = state.length();
+        const Container list = makeContainer<Container>(makeValues<T>(n));
+        const T target = makeValue<T>(n - 1);
+
+        while (state.keepRunning()) {
+            Bench::doNotOptimize(Ops::find(list, target));
+        }
+    }
+
+    template <typename Container, typename T>
+    void benchContains(Bench::State& state)
+    {
+        using Ops = ContainerOps<Container, T>;
+
+        const size_t n = state.length();
+        const Container list = makeContainer<Container>(makeValues<T>(n));
+        const T target = makeValue<T>(n - 1);
+
+        while (state.keepRunning()) {
+            Bench::doNotOptimize(Ops::contains(list, target));
+        }
+    }
+
+    /*  Удаление элемента из середины контейнера.
+        Если remove() выполняется за O(1), из каждой копии удаляются все элементы в случайном порядке:
+        иначе на одно удаление приходилась бы подготовка копии за O(n), и подбор числа итераций длился бы часами.  */
+    template <typename Container, typename T>
+    void benchRemove(Bench::State& state)
+    {
+        using Ops = ContainerOps<Container, T>;
+
+        const size_t n = state.length();
+        const size_t copies = batchCount(n);
+        const Container prototype = makeContainer<Container>(makeValues<T>(n));
+        const std::vector<T> targets = Ops::cheapRemove ? makeShuffledValues<T>(n) : std::vector<T>{makeValue<T>(n / 2)};
+        std::vector<Container> lists;
+
+        while (state.keepRunning())
+        {
+            state.pauseTiming();
+            resetCopies(lists, copies, prototype);
+            state.resumeTiming();
+
+            for (Container& list : lists)
+            {
+                for (const T& target : targets) {
+                    Bench::doNotOptimize(Ops::remove(list, target));
+                }
+            }
+        }
+
+        state.setItemsPerIteration(copies * targets.size());
+    }
+
+    // Удаление всех вхождений значения, которым равен каждый четвертый элемент.
+    template <typename Container, typename T>
+    void benchRemoveAll(Bench::State& state)
+    {
+        using Ops = ContainerOps<Container, T>;
+
+        const size_t n = state.length();
+        const size_t copies = batchCount(n);
+        std::vector<T> values;
+
+        for (size_t i = 0; i < n; ++i) {
+            values.push_back(makeValue<T>(i % 4 == 0 ? 0 : i));
+        }
+
+        const Container prototype = makeContainer<Container>(values);
+        const T target = makeValue<T>(0);
+        std::vector<Container> lists;
+
+        while (state.keepRunning())
+        {
+            state.pauseTiming();
+            resetCopies(lists, copies, prototype);
+            state.resumeTiming();
+
+            for (Container& list : lists) {
+                Ops::removeAll(list, target);
+            }
+        }
+
+        state.setItemsPerIteration(copies);
+    }
+
+    // Обращение по случайному индексу.
+    template <typename Container, typename T>
+    void benchIndexRandom(Bench::State& state)
+    {
+        using Ops = ContainerOps<Container, T>;
+
+        const size_t n = state.length();
+        Container list = makeContainer<Container>(makeValues<T>(n));
+
+        std::vector<size_t> indices(1024);
+        std::mt19937_64 random(7);
+
+        for (size_t& index : indices) {
+            index = static_cast<size_t>(random() % n);
+        }
+
+        size_t next = 0;
+
+        while (state.keepRunning()) {
+            Bench::doNotOptimize(Ops::at(list, indices[next++ % indices.size()]));
+        }
+    }
+
+    // Обход всех элементов по индексу: list[0], list[1], ...
+    template <typename Container, typename T>
+    void benchIndexSequential(Bench::State& state)
+    {
+        using Ops = ContainerOps<Container, T>;
+
+        const size_t n = state.length();
+        Container list = makeContainer<Container>(makeValues<T>(n));
+
+        while (state.keepRunning())
+        {
+            for (size_t i = 0; i < n; ++i) {
+                Bench::doNotOptimize(Ops::at(list, i));
+            }
+        }
+
+        state.setItemsPerIteration(n);
+    }
+
+    /*  Метод сортирует контейнер пузырьком, обменивая значения соседних элементов, - так, как это делал
+        LinkedList::sort() до перехода на сортировку слиянием. Нужен только как базовая линия для "sort".  */
+    template <typename Container>
+    void bubbleSort(Container& list)
+    {
+        // 1. Если в контейнере меньше 2-х элементов - сортировать ничего не нужно.
+        if (list.begin() == list.end() || std::next(list.begin()) == list.end()) {
+            return;
+        }
+
+        bool isSwapped = false;
+
+        // 2. Проходы повторяются, пока на очередном проходе есть обмены.
+        do
+        {
+            isSwapped = false;
+
+            for (auto current = list.begin(), next = std::next(current); next != list.end(); current = next++)
+            {
+                if (*next < *current)
+                {
+                    using std::swap;
+                    swap(*current, *next);
+                    isSwapped = true;
+                }
+            }
+
+        } while (isSwapped);
+    }
+
+    template <typename Container, typename T>
+    void benchBubbleSort(Bench::State& state)
+    {
+        const size_t n = state.length();
+        const size_t copies = batchCount(n);
+        const Container prototype = makeContainer<Container>(makeShuffledValues<T>(n));
+        std::vector<Container> lists;
+
+        while (state.keepRunning())
+        {
+            state.pauseTiming();
+            resetCopies(lists, copies, prototype);
+            state.resumeTiming();
+
+            for (Container& list : lists) {
+                bubbleSort(list);
+            }
+        }
+
+        state.setItemsPerIteration(copies * n);
+    }
+
+    template <typename Container, typename T, bool Parallel>
+    void benchSort(Bench::State& state)
+    {
+        using Ops = ContainerOps<Container, T>;
+
+        const size_t n = state.length();
+        const size_t copies = batchCount(n);
+        const Container prototype = makeContainer<Container>(makeShuffledValues<T>(n));
+        std::vector<Container> lists;
+
+        while (state.keepRunning())
+        {
+            state.pauseTiming();
+            resetCopies(lists, copies, prototype);
+            state.resumeTiming();
+
+            for (Container& list : lists)
+            {
+                if constexpr (Parallel) {
+                    list.sort(Containers::execution::par);
+                }
+                else {
+                    Ops::sort(list);
+                }
+            }
+        }
+
+        state.setItemsPerIteration(copies * n);
+    }
+
+    template <typename Container, typename T>
+    void benchCopyConstruct(Bench::State& state)
+    {
+        const size_t n = state.length();
+        const size_t copies = batchCount(n);
+        const Container prototype = makeContainer<Container>(makeValues<T>(n));
+        std::vector<Container> lists;
+
+        while (state.keepRunning())
+        {
+            state.pauseTiming();
+            lists.clear();
+            lists.reserve(copies);
+            state.resumeTiming();
+
+            for (size_t i = 0; i < copies; ++i) {
+                lists.emplace_back(prototype);
+            }
+        }
+
+        state.setItemsPerIteration(copies * n);
+    }
+
+    // Присваивание копии контейнеру той же длины с другими значениями.
+    template <typename Container, typename T>
+    void benchCopyAssign(Bench::State& state)
+    {
+        const size_t n = state.length();
+        const size_t copies = batchCount(n);
+        const Container prototype = makeContainer<Container>(makeValues<T>(n));
+        const Container other = makeContainer<Container>(makeShuffledValues<T>(n));
+        std::vector<Container> lists;
+
+        while (state.keepRunning())
+        {
+            state.pauseTiming();
+            resetCopies(lists, copies, other);
+            state.resumeTiming();
+
+            for (Container& list : lists) {
+                list = prototype;
+            }
+        }
+
+        state.setItemsPerIteration(copies * n);
+    }
+
+    template <typename Container, typename T>
+    void benchClear(Bench::State& state)
+    {
+        using Ops = ContainerOps<Container, T>;
+
+        const size_t n = state.length();
+        const size_t copies = batchCount(n);
+        const Container prototype = makeContainer<Container>(makeValues<T>(n));
+        std::vector<Container> lists;
+
+        while (state.keepRunning())
+        {
+            state.pauseTiming();
+            resetCopies(lists, copies, prototype);
+            state.resumeTiming();
+
+            for (Container& list : lists) {
+                Ops::clear(list);
+            }
+        }
+
+        state.setItemsPerIteration(copies * n);
+    }
+
+    template <typename Container, typename T>
+    void benchTraverse(Bench::State& state)
+    {
+        const size_t n = state.length();
+        Container list = makeContainer<Container>(makeValues<T>(n));
+
+        while (state.keepRunning())
+        {
+            for (const auto& value : list) {
+                Bench::doNotOptimize(value);
+            }
+        }
+
+        state.setItemsPerIteration(n);
+    }
+
+    // Смешанная нагрузка на оба конца (длина контейнера не меняется): pushBack, popFront, pushFront, popBack.
+    template <typename Container, typename T>
+    void benchPushPopMix(Bench::State& state)
+    {
+        using Ops = ContainerOps<Container, T>;
+
+        const size_t n = state.length();
+        Container list = makeContainer<Container>(makeValues<T>(n));
+        const T value = makeValue<T>(n);
+
+        while (state.keepRunning())
+        {
+            Ops::pushBack(list, value);
+            Bench::doNotOptimize(Ops::popFront(list));
+            Ops::pushFront(list, value);
+            Bench::doNotOptimize(Ops::popBack(list));
+        }
+
+        state.setItemsPerIteration(4);
+    }
+
+    // Метод возвращает длины 10, 100, ..., не превышающие maxN.
+    std::vector<size_t> lengths(size_t maxN)
+    {
+        std::vector<size_t> result;
+
+        for (size_t n = 10; n <= maxN && n <= 10000000; n *= 10) {
+            result.push_back(n);
+        }
+
+        return result;
+    }
+
+    // Метод регистрирует все операции, которые поддерживает контейнер Container.
+    template <typename Container, typename T>
+    void registerSuite(const std::string& container, const std::string& element, size_t maxN)
+    {
+        using Ops = ContainerOps<Container, T>;
+
+        for (size_t n : lengths(maxN))
+        {
+            auto add = [&](const char* operation, void (*body)(Bench::State&)) {
+                Bench::registerBenchmark(operation, container, element, n, body);
+            };
+
+            if constexpr (Ops::hasPushBack) {
+                add("pushBack", benchPushBack<Container, T>);
+            }
+
+            add("pushFront", benchPushFront<Container, T>);
+            add("popFront", benchPopFront<Container, T>);
+
+            if constexpr (Ops::hasPopBack) {
+                add("popBack", benchPopBack<Container, T>);
+            }
+
+            if constexpr (Ops::hasPushBack && Ops::hasPopBack) {
+                add("pushPopMix", benchPushPopMix<Container, T>);
+            }
+
+            add("find", benchFind<Container, T>);
+            add("contains", benchContains<Container, T>);
+            add("remove", benchRemove<Container, T>);
+            add("removeAll", benchRemoveAll<Container, T>);
+
+            add("indexRandom", benchIndexRandom<Container, T>);
+
+            if (Ops::cheapIndex || n <= quadraticLimit) {
+                add("indexSequential", benchIndexSequential<Container, T>);
+            }
+
+            if constexpr (Ops::hasSort) {
+                add("sort", benchSort<Container, T, false>);
+            }
+
+            // Сортировка пузырьком за O(n^2) замеряется до той же длины, что и обращение по индексу за O(n).
+            if constexpr (Ops::hasLegacySort)
+            {
+                if (n <= quadraticLimit) {
+                    add("sortBubble", benchBubbleSort<Container, T>);
+                }
+            }
+
+            if constexpr (Ops::hasParallelSort) {
+                add("sortParallel", benchSort<Container, T, true>);
+            }
+
+            add("copyConstruct", benchCopyConstruct<Container, T>);
+            add("copyAssign", benchCopyAssign<Container, T>);
+            add("clear", benchClear<Container, T>);
+            add("traverse", benchTraverse<Container, T>);
+        }
+    }
+
+    // Все контейнеры сравниваются на элементах трех размеров.
+    template <typename T>
+    void registerBaselines(const std::string& element, size_t maxN)
+    {
+        registerSuite<Containers::LinkedList<T>, T>("LinkedList", element, maxN);
+        registerSuite<std::list<T>, T>("std::list", element, maxN);
+        registerSuite<std::forward_list<T>, T>("std::forward_list", element, maxN);
+        registerSuite<std::deque<T>, T>("std::deque", element, maxN);
+    }
+
+    // Варианты списка сравниваются на элементах int.
+    void registerVariants(size_t maxN)
+    {
+        registerSuite<Containers::LinkedList<int, Containers::PoolAllocator<int>>, int>("LinkedList<PoolAllocator>", "int", maxN);
+        registerSuite<Containers::LinkedList<int, std::allocator<int>, Containers::ListStats<>>, int>("LinkedList<ListStats>", "int", maxN);
+        registerSuite<Containers::LinkedList<int, std::allocator<int>, Containers::ListStats<true>>, int>("LinkedList<ListStats<true>>", "int", maxN);
+        registerSuite<Containers::UnrolledLinkedList<int>, int>("UnrolledLinkedList", "int", maxN);
+        registerSuite<Containers::DoublyLinkedList<int>, int>("DoublyLinkedList", "int", maxN);
+        registerSuite<Containers::XorLinkedList<int>, int>("XorLinkedList", "int", maxN);
+        registerSuite<Containers::IndexedLinkedList<int>, int>("IndexedLinkedList", "int", maxN);
+        registerSuite<Containers::HashedLinkedList<int>, int>("HashedLinkedList", "int", maxN);
+        registerSuite<Containers::SharedLinkedList<int>, int>("SharedLinkedList", "int", maxN);
+    }
+
+    /*  Метод строит фрагментированный список: узлы выделяются в случайном порядке значений,
+        после чего сортировка перестраивает указатели, и порядок обхода перестает совпадать с порядком в памяти.  */
+    template <typename T>
+    void makeFragmented(Containers::LinkedList<T>& list, size_t n)
+    {
+        for (const T& value : makeShuffledValues<T>(n)) {
+            list.pushBack(value);
+        }
+
+        list.sort();
+    }
+
+    // Обход фрагментированного списка до (Compacted = false) и после (Compacted = true) compact().
+    template <typename T, bool Compacted>
+    void benchTraverseFragmented(Bench::State& state)
+    {
+        const size_t n = state.length();
+        Containers::LinkedList<T> list;
+        makeFragmented(list, n);
+
+        if constexpr (Compacted) {
+            list.compact();
+        }
+
+        while (state.keepRunning())
+        {
+            for (const T& value : list) {
+                Bench::doNotOptimize(value);
+            }
+        }
+
+        state.setItemsPerIteration(n);
+    }
+
+    // Стоимость самой компактизации фрагментированного списка.
+    template <typename T>
+    void benchCompact(Bench::State& state)
+    {
+        const size_t n = state.length();
+        const size_t copies = batchCount(n);
+        std::vector<Containers::LinkedList<T>> lists;
+
+        while (state.keepRunning())
+        {
+            state.pauseTiming();
+            lists.clear();
+            lists.resize(copies);
+
+            for (Containers::LinkedList<T>& list : lists) {
+                makeFragmented(list, n);
+            }
+
+            state.resumeTiming();
+
+            for (Containers::LinkedList<T>& list : lists) {
+                list.compact();
+            }
+        }
+
+        state.setItemsPerIteration(copies * n);
+    }
+
+    template <typename T>
+    void registerCompaction(const std::string& element, size_t maxN)
+    {
+        for (size_t n : lengths(maxN))
+        {
+            Bench::registerBenchmark("traverseFragmented", "LinkedList", element, n, benchTraverseFragmented<T, false>);
+            Bench::registerBenchmark("traverseCompacted", "LinkedList", element, n, benchTraverseFragmented<T, true>);
+            Bench::registerBenchmark("compact", "LinkedList", element, n, benchCompact<T>);
+        }
+    }
+
+    /*  Снимки для читателей: на каждой итерации писатель делает снимок списка, читатель обходит его целиком,
+        после чего писатель обновляет начало списка (popFront() + pushFront()).
+        Для LinkedList снимок - глубокая копия, для SharedLinkedList - разделение узлов.  */
+    template <typename Container, typename T>
+    void benchSnapshotRead(Bench::State& state)
+    {
+        const size_t n = state.length();
+        const std::vector<T> values = makeValues<T>(n);
+        Container list = makeContainer<Container>(values);
+        Container snapshot;
+        size_t next = 0;
+
+        while (state.keepRunning())
+        {
+            snapshot = list;
+
+            for (const T& value : snapshot) {
+                Bench::doNotOptimize(value);
+            }
+
+            list.popFront();
+            list.pushFront(values[next]);
+            next = (next + 1) % n;
+        }
+
+        state.setItemsPerIteration(n);
+    }
+
+    template <typename T>
+    void registerSnapshots(const std::string& element, size_t maxN)
+    {
+        for (size_t n : lengths(maxN))
+        {
+            Bench::registerBenchmark("snapshotRead", "LinkedList", element, n, benchSnapshotRead<Containers::LinkedList<T>, T>);
+            Bench::registerBenchmark("snapshotRead", "SharedLinkedList", element, n, benchSnapshotRead<Containers::SharedLinkedList<T>, T>);
+        }
+    }
+
+    /*  Перенос всех элементов списка между двумя стадиями конвейера и обратно:
+        Splice = true - append() (перевешивание узлов за O(1)), иначе - поэлементно через popFront() / pushBack().  */
+    template <typename T, bool Splice>
+    void benchMoveAll(Bench::State& state)
+    {
+        const size_t n = state.length();
+        Containers::LinkedList<T> first = makeContainer<Containers::LinkedList<T>>(makeValues<T>(n));
+        Containers::LinkedList<T> second;
+
+        while (state.keepRunning())
+        {
+            if constexpr (Splice)
+            {
+                second.append(std::move(first));
+                first.append(std::move(second));
+            }
+            else
+            {
+                while (!first.isEmpty()) {
+                    second.pushBack(first.popFront());
+                }
+
+                while (!second.isEmpty()) {
+                    first.pushBack(second.popFront());
+                }
+            }
+        }
+
+        state.setItemsPerIteration(2 * n);
+    }
+
+    // Отделение второй половины списка splitAt() и возврат ее на место append() (O(n) из-за поиска середины и подсчета длины).
+    template <typename T>
+    void benchSplitAppend(Bench::State& state)
+    {
+        const size_t n = state.length();
+        Containers::LinkedList<T> list = makeContainer<Containers::LinkedList<T>>(makeValues<T>(n));
+
+        while (state.keepRunning())
+        {
+            auto middle = list.begin();
+
+            for (size_t i = 1; i < n / 2; ++i) {
+                ++middle;
+            }
+
+            Containers::LinkedList<T> suffix = list.splitAt(middle);
+            list.append(std::move(suffix));
+        }
+
+        state.setItemsPerIteration(n);
+    }
+
+    // Построение списка из диапазона (конструктор из пары итераторов) - сравнивается с pushBack.
+    template <typename T>
+    void benchRangeConstruct(Bench::State& state)
+    {
+        const size_t n = state.length();
+        const size_t copies = batchCount(n);
+        const std::vector<T> values = makeValues<T>(n);
+        std::vector<Containers::LinkedList<T>> lists;
+
+        while (state.keepRunning())
+        {
+            state.pauseTiming();
+            lists.clear();
+            lists.reserve(copies);
+            state.resumeTiming();
+
+            for (size_t i = 0; i < copies; ++i) {
+                lists.emplace_back(values.begin(), values.end());
+            }
+        }
+
+        state.setItemsPerIteration(copies * n);
+    }
+
+    template <typename T>
+    void registerSplicing(const std::string& element, size_t maxN)
+    {
+        for (size_t n : lengths(maxN))
+        {
+            Bench::registerBenchmark("appendSplice", "LinkedList", element, n, benchMoveAll<T, true>);
+            Bench::registerBenchmark("appendElementwise", "LinkedList", element, n, benchMoveAll<T, false>);
+            Bench::registerBenchmark("splitAppend", "LinkedList", element, n, benchSplitAppend<T>);
+            Bench::registerBenchmark("rangeConstruct", "LinkedList", element, n, benchRangeConstruct<T>);
+        }
+    }
+
+    /*  Задержка разрушения списка длины n (список строится вне замера, итераций - фиксированное число).
+        Deferred = true - список в режиме отложенного освобождения. В отчет попадает и худшая задержка max_ns.  */
+    template <typename Container, typename T, bool Deferred>
+    void benchDestroy(Bench::State& state)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        const std::vector<T> values = makeValues<T>(state.length());
+        double maxNs = 0;
+
+        while (state.keepRunning())
+        {
+            state.pauseTiming();
+
+            // Предыдущие цепочки освобождаются вне замера, чтобы фоновый поток не мешал построению списка.
+            Containers::NodeReclaimer::instance().drain();
+
+            auto list = std::make_unique<Container>();
+
+            if constexpr (Deferred) {
+                list->setDeferredReclamation(true);
+            }
+
+            fill(*list, values);
+            state.resumeTiming();
+
+            const Clock::time_point start = Clock::now();
+            list.reset();
+            maxNs = std::max(maxNs, std::chrono::duration<double, std::nano>(Clock::now() - start).count());
+        }
+
+        Containers::NodeReclaimer::instance().drain();
+        state.setItemsPerIteration(state.length());
+        state.setCounter("max_ns", maxNs);
+    }
+
+    template <typename T>
+    void registerTeardown(const std::string& element, size_t maxN)
+    {
+        constexpr size_t iterations = 5;
+
+        for (size_t n : lengths(maxN))
+        {
+            Bench::registerBenchmark("destroy", "LinkedList", element, n,
+                                     benchDestroy<Containers::LinkedList<T>, T, false>, iterations);
+            Bench::registerBenchmark("destroy", "LinkedList(deferred)", element, n,
+                                     benchDestroy<Containers::LinkedList<T>, T, true>, iterations);
+            Bench::registerBenchmark("destroy", "LinkedList<PoolAllocator>(deferred)", element, n,
+                                     benchDestroy<Containers::LinkedList<T, Containers::PoolAllocator<T>>, T, true>, iterations);
+            Bench::registerBenchmark("destroy", "std::list", element, n,
+                                     benchDestroy<std::list<T>, T, false>, iterations);
+        }
+    }
+
+    // ListFile - временный файл со списком из n элементов (формат LinkedList::saveTo()), удаляется деструктором.
+    template <typename T>
+    struct ListFile
+    {
+        std::string path;
+
+        explicit ListFile(size_t n)
+        : path((std::filesystem::temp_directory_path() / ("list_benchmarks_" + std::to_string(n) + ".bin")).string())
+        {
+            Containers::LinkedList<T> list;
+            fill(list, makeValues<T>(n));
+            list.saveTo(path);
+        }
+
+        ~ListFile()
+        {
+            std::error_code ignored;
+            std::filesystem::remove(path, ignored);
+        }
+
+        /*  Метод вытесняет страницы файла из кэша операционной системы, чтобы следующее чтение было холодным
+            (где это невозможно - чтение идет из кэша).  */
+        void dropCache() const
+        {
+#if defined(CONTAINERS_HAS_MMAP) && defined(POSIX_FADV_DONTNEED)
+            const int descriptor = ::open(path.c_str(), O_RDONLY);
+
+            if (descriptor >= 0)
+            {
+                posix_fadvise(descriptor, 0, 0, POSIX_FADV_DONTNEED);
+                ::close(descriptor);
+            }
+#endif
+        }
+    };
+
+    /*  Холодная загрузка списка длины n из файла (итераций - фиксированное число, кэш файла сбрасывается вне замера).
+        Loader - способ загрузки: LinkedList::loadFrom(), поэлементное чтение с pushBack() или MappedListView.
+        Загруженный список обходится, чтобы в замер попало и обращение к элементам.  */
+    enum class Loader { LoadFrom, PushBack, Mapped };
+
+    // Метод возвращает величину, зависящую от элемента (чтобы обход нельзя было выбросить).
+    template <typename T>
+    size_t touch(const T& value)
+    {
+        if constexpr (std::is_arithmetic_v<T>) {
+            return static_cast<size_t>(value);
+        }
+        else {
+            return value.size();
+        }
+    }
+
+    template <typename T, Loader Kind>
+    void benchLoad(Bench::State& state)
+    {
+        const ListFile<T> file(state.length());
+        size_t checksum = 0;
+
+        while (state.keepRunning())
+        {
+            state.pauseTiming();
+            file.dropCache();
+            state.resumeTiming();
+
+            if constexpr (Kind == Loader::Mapped)
+            {
+                const Containers::MappedListView<T> view(file.path);
+
+                for (const T& value : view) {
+                    checksum += touch(value);
+                }
+
+                state.pauseTiming();
+            }
+            else
+            {
+                Containers::LinkedList<T> list;
+
+                if constexpr (Kind == Loader::LoadFrom) {
+                    list.loadFrom(file.path);
+                }
+                else
+                {
+                    // Тот же файл читается по одному элементу, и каждый элемент добавляется в конец списка.
+                    std::ifstream in(file.path, std::ios::binary);
+                    Containers::ListFileHeader header(Containers::ElementKind::Unspecified, 0, 0);
+                    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+                    for (std::uint64_t i = 0; i < header.count; ++i)
+                    {
+                        if constexpr (Containers::ListSerializer<T>::raw)
+                        {
+                            T value;
+                            in.read(reinterpret_cast<char*>(&value), sizeof(value));
+                            list.pushBack(value);
+                        }
+                        else {
+                            list.pushBack(Containers::ListSerializer<T>::read(in));
+                        }
+                    }
+                }
+
+                for (const T& value : list) {
+                    checksum += touch(value);
+                }
+
+                // Разрушение списка в замер не входит.
+                state.pauseTiming();
+            }
+        }
+
+        Bench::doNotOptimize(checksum);
+        state.setItemsPerIteration(state.length());
+    }
+
+    template <typename T>
+    void registerLoading(const std::string& element, size_t maxN)
+    {
+        constexpr size_t iterations = 3;
+
+        for (size_t n : lengths(maxN))
+        {
+            Bench::registerBenchmark("load", "LinkedList::loadFrom", element, n, benchLoad<T, Loader::LoadFrom>, iterations);
+            Bench::registerBenchmark("load", "LinkedList::pushBack", element, n, benchLoad<T, Loader::PushBack>, iterations);
+
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                Bench::registerBenchmark("load", "MappedListView", element, n, benchLoad<T, Loader::Mapped>, iterations);
+            }
+        }
+    }
+
+    // SimdOperation - операция поиска, которая замеряется на разных наборах инструкций.
+    enum class SimdOperation { Find, Count, RemoveAll };
+
+    /*  Поиск отсутствующего значения (полный проход, как при промахе проверки принадлежности) в списке длины n
+        на наборе инструкций Level. removeAll() отсутствующего значения список не меняет, поэтому замеряет сам поиск.  */
+    template <typename Container, typename T, SimdOperation Operation, Containers::simd::Level Level>
+    void benchSimd(Bench::State& state)
+    {
+        const size_t n = state.length();
+        Container list = makeContainer<Container>(makeValues<T>(n));
+        const T target = makeValue<T>(n);
+
+        Containers::simd::setMaxLevel(Level);
+
+        while (state.keepRunning())
+        {
+            if constexpr (Operation == SimdOperation::Find) {
+                Bench::doNotOptimize(list.find(target));
+            }
+            else if constexpr (Operation == SimdOperation::Count) {
+                Bench::doNotOptimize(list.count(target));
+            }
+            else {
+                Bench::doNotOptimize(list.removeAll(target));
+            }
+        }
+
+        Containers::simd::setMaxLevel(Containers::simd::Level::AVX2);
+        state.setItemsPerIteration(n);
+    }
+
+    template <typename T, typename Container, Containers::simd::Level Level>
+    void registerSimdLevel(const std::string& container, const std::string& element, size_t n)
+    {
+        // Уровни, которые не поддерживает процессор, не регистрируются (иначе они молча замерили бы меньший уровень).
+        if (Level > Containers::simd::supportedLevel()) {
+            return;
+        }
+
+        Bench::registerBenchmark("simdFind", container, element, n, benchSimd<Container, T, SimdOperation::Find, Level>);
+        Bench::registerBenchmark("simdCount", container, element, n, benchSimd<Container, T, SimdOperation::Count, Level>);
+        Bench::registerBenchmark("simdRemoveAll", container, element, n, benchSimd<Container, T, SimdOperation::RemoveAll, Level>);
+    }
+
+    template <typename T>
+    void registerSimd(const std::string& element, size_t maxN)
+    {
+        using Level = Containers::simd::Level;
+        using Unrolled = Containers::UnrolledLinkedList<T>;
+        using Unrolled512 = Containers::UnrolledLinkedList<T, std::allocator<T>, 512>;
+
+        for (size_t n : lengths(maxN))
+        {
+            // LinkedList (один элемент на узел) - базовая линия.
+            Bench::registerBenchmark("simdFind", "LinkedList", element, n,
+                                     benchSimd<Containers::LinkedList<T>, T, SimdOperation::Find, Level::Scalar>);
+
+            registerSimdLevel<T, Unrolled, Level::Scalar>("UnrolledLinkedList[scalar]", element, n);
+            registerSimdLevel<T, Unrolled, Level::SSE2>("UnrolledLinkedList[sse2]", element, n);
+            registerSimdLevel<T, Unrolled, Level::AVX2>("UnrolledLinkedList[avx2]", element, n);
+            registerSimdLevel<T, Unrolled512, Level::Scalar>("UnrolledLinkedList<512>[scalar]", element, n);
+            registerSimdLevel<T, Unrolled512, Level::AVX2>("UnrolledLinkedList<512>[avx2]", element, n);
+        }
+    }
+
+    // ParallelOperation - параллельный алгоритм, ускорение которого замеряется.
+    enum class ParallelOperation { Transform, ForEach, Reduce, CountIf, FindIf };
+
+    // Дорогая обработка элемента (несколько десятков наносекунд): на ней распараллеливание окупается.
+    inline std::uint64_t heavyHash(std::uint64_t value)
+    {
+        for (int round = 0; round < 16; ++round)
+        {
+            value ^= value >> 33;
+            value *= 0xff51afd7ed558ccdULL;
+        }
+
+        return value;
+    }
+
+    /*  Параллельный алгоритм на пуле из threads потоков над списком длины n.
+        transform и forEach выполняют дорогую обработку элемента, reduce, countIf и findIf - дешевую
+        (для них заметна цена предварительного прохода по цепочке). findIf ищет последний элемент.  */
+    template <ParallelOperation Operation>
+    void benchParallel(Bench::State& state, size_t threads)
+    {
+        const size_t n = state.length();
+        Containers::LinkedList<std::uint64_t> list;
+        fill(list, std::vector<std::uint64_t>(n, 1));
+        list.back() = 2;
+
+        Containers::WorkStealingPool pool(threads);
+
+        while (state.keepRunning())
+        {
+            if constexpr (Operation == ParallelOperation::Transform) {
+                Containers::parallel::transform(pool, list, [](std::uint64_t value) { return heavyHash(value) | 1; });
+            }
+            else if constexpr (Operation == ParallelOperation::ForEach)
+            {
+                Containers::parallel::forEach(pool, list, [](std::uint64_t& value) {
+                    Bench::doNotOptimize(heavyHash(value));
+                });
+            }
+            else if constexpr (Operation == ParallelOperation::Reduce) {
+                Bench::doNotOptimize(Containers::parallel::reduce(pool, list, std::uint64_t(0)));
+            }
+            else if constexpr (Operation == ParallelOperation::CountIf) {
+                Bench::doNotOptimize(Containers::parallel::countIf(pool, list, [](std::uint64_t value) { return value == 2; }));
+            }
+            else {
+                Bench::doNotOptimize(Containers::parallel::findIf(pool, list, [](std::uint64_t value) { return value == 2; }));
+            }
+        }
+
+        state.setItemsPerIteration(n);
+        state.setCounter("threads", static_cast<double>(pool.concurrency()));
+    }
+
+    // Ускорение замеряется на 1, 2, 4, ... потоках (до числа аппаратных потоков) на длине min(maxN, 10^6).
+    void registerParallel(size_t maxN)
+    {
+        const size_t n = std::min<size_t>(maxN, 1000000);
+        const size_t hardware = std::max<size_t>(1, std::thread::hardware_concurrency());
+
+        for (size_t threads = 1; ; threads = std::min(threads * 2, hardware))
+        {
+            const std::string container = "LinkedList[threads=" + std::to_string(threads) + "]";
+
+            auto add = [&](const std::string& operation, void (*body)(Bench::State&, size_t)) {
+                Bench::registerBenchmark(operation, container, "uint64", n, [body, threads](Bench::State& state) {
+                    body(state, threads);
+                });
+            };
+
+            add("parallelTransform", benchParallel<ParallelOperation::Transform>);
+            add("parallelForEach", benchParallel<ParallelOperation::ForEach>);
+            add("parallelReduce", benchParallel<ParallelOperation::Reduce>);
+            add("parallelCountIf", benchParallel<ParallelOperation::CountIf>);
+            add("parallelFindIf", benchParallel<ParallelOperation::FindIf>);
+
+            if (threads == hardware) {
+                break;
+            }
+        }
+    }
+
+    // AllocationCounter - общий для всех CountingAllocator счетчик занятой памяти.
+    struct AllocationCounter
+    {
+        static inline size_t liveBytes = 0;
+
+        // Количество вызовов allocate() за все время.
+        static inline size_t allocations = 0;
+    };
+
+    // CountingAllocator - аллокатор, подсчитывающий занятую контейнером память.
+    template <typename T>
+    struct CountingAllocator
+    {
+        using value_type = T;
+
+        CountingAllocator() = default;
+
+        template <typename U>
+        CountingAllocator(const CountingAllocator<U>&) {}
+
+        T* allocate(size_t count)
+        {
+            AllocationCounter::liveBytes += count * sizeof(T);
+            ++AllocationCounter::allocations;
+            return std::allocator<T>().allocate(count);
+        }
+
+        void deallocate(T* pointer, size_t count)
+        {
+            AllocationCounter::liveBytes -= count * sizeof(T);
+            std::allocator<T>().deallocate(pointer, count);
+        }
+
+        template <typename U>
+        bool operator==(const CountingAllocator<U>&) const {
+            return true;
+        }
+
+        template <typename U>
+        bool operator!=(const CountingAllocator<U>&) const {
+            return false;
+        }
+    };
+
+    /*  Footprint - память, которую контейнер получил от распределителя: для CountingAllocator -
+        показания AllocationCounter, для PoolAllocator - память и обращения к operator new его пула.  */
+    template <typename Container>
+    struct Footprint
+    {
+        static size_t bytes(const Container&) {
+            return AllocationCounter::liveBytes;
+        }
+
+        static size_t allocations(const Container&) {
+            return AllocationCounter::allocations;
+        }
+    };
+
+    template <typename T, typename Stats, size_t N>
+    struct Footprint<Containers::LinkedList<T, Containers::PoolAllocator<T>, Stats, N>>
+    {
+        using Container = Containers::LinkedList<T, Containers::PoolAllocator<T>, Stats, N>;
+
+        static size_t bytes(const Container& list) {
+            return list.getAllocator().getPool()->reservedBytes();
+        }
+
+        static size_t allocations(const Container& list) {
+            return list.getAllocator().getPool()->systemAllocationCount();
+        }
+    };
+
+    /*  Метод возвращает резидентную память процесса (RSS) в байтах или 0, если ее не узнать (не Linux).
+        Перед замером освобожденная память возвращается системе, чтобы приращение RSS относилось к новым выделениям.  */
+    size_t residentBytes()
+    {
+#ifdef __GLIBC__
+        malloc_trim(0);
+#endif
+#ifdef __linux__
+        std::ifstream statm("/proc/self/statm");
+        size_t totalPages = 0;
+        size_t residentPages = 0;
+
+        if (statm >> totalPages >> residentPages) {
+            return residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        }
+#endif
+        return 0;
+    }
+
+    /*  Память, занимаемая контейнером из n элементов int. Время - время заполнения. Счетчики:
+        bytes_per_element - память, полученная от распределителя (без его служебных данных),
+        allocations_per_element - обращения к распределителю (для PoolAllocator - обращения пула к operator new),
+        rss_bytes_per_element - приращение резидентной памяти процесса (замеряется отдельно от цикла, только в Linux;
+        на коротких списках округляется до страниц и неточно).  */
+    template <typename Container>
+    void benchFootprint(Bench::State& state)
+    {
+        using Measure = Footprint<Container>;
+
+        const size_t n = state.length();
+        const std::vector<int> values = makeValues<int>(n);
+        size_t bytes = 0;
+        size_t allocations = 0;
+
+        while (state.keepRunning())
+        {
+            Container list;
+            const size_t bytesBefore = Measure::bytes(list);
+            const size_t allocationsBefore = Measure::allocations(list);
+            fill(list, values);
+
+            state.pauseTiming();
+            bytes = Measure::bytes(list) - bytesBefore;
+            allocations = Measure::allocations(list) - allocationsBefore;
+            ContainerOps<Container, int>::clear(list);
+            state.resumeTiming();
+        }
+
+        state.setItemsPerIteration(n);
+        state.setCounter("bytes_per_element", static_cast<double>(bytes) / static_cast<double>(n));
+        state.setCounter("allocations_per_element", static_cast<double>(allocations) / static_cast<double>(n));
+
+        const size_t rssBefore = residentBytes();
+
+        if (rssBefore != 0)
+        {
+            Container list;
+            fill(list, values);
+            const size_t rssAfter = residentBytes();
+            const size_t rss = rssAfter > rssBefore ? rssAfter - rssBefore : 0;
+            state.setCounter("rss_bytes_per_element", static_cast<double>(rss) / static_cast<double>(n));
+        }
+    }
+
+    void registerFootprints(size_t maxN)
+    {
+        using Counting = CountingAllocator<int>;
+
+        for (size_t n : lengths(maxN))
+        {
+            Bench::registerBenchmark("footprint", "LinkedList", "int", n, benchFootprint<Containers::LinkedList<int, Counting>>);
+            Bench::registerBenchmark("footprint", "LinkedList<PoolAllocator>", "int", n,
+                                     benchFootprint<Containers::LinkedList<int, Containers::PoolAllocator<int>>>);
+            Bench::registerBenchmark("footprint", "UnrolledLinkedList", "int", n, benchFootprint<Containers::UnrolledLinkedList<int, Counting>>);
+            Bench::registerBenchmark("footprint", "DoublyLinkedList", "int", n, benchFootprint<Containers::DoublyLinkedList<int, Counting>>);
+            Bench::registerBenchmark("footprint", "XorLinkedList", "int", n, benchFootprint<Containers::XorLinkedList<int, Counting>>);
+            Bench::registerBenchmark("footprint", "IndexedLinkedList", "int", n, benchFootprint<Containers::IndexedLinkedList<int, Counting>>);
+            Bench::registerBenchmark("footprint", "HashedLinkedList", "int", n,
+                                     benchFootprint<Containers::HashedLinkedList<int, std::hash<int>, std::equal_to<int>, Counting>>);
+            Bench::registerBenchmark("footprint", "std::list", "int", n, benchFootprint<std::list<int, Counting>>);
+            Bench::registerBenchmark("footprint", "std::forward_list", "int", n, benchFootprint<std::forward_list<int, Counting>>);
+            Bench::registerBenchmark("footprint", "std::deque", "int", n, benchFootprint<std::deque<int, Counting>>);
+        }
+    }
+
+    /*  Множество коротких списков: n элементов раскладываются по спискам длины Length, списки хранятся
+        в std::vector, обходятся и разрушаются. Счетчики: allocations_per_list - выделения памяти на один список,
+        object_bytes - sizeof самого списка, bytes_per_list - object_bytes плюс занятая списком динамическая память.  */
+    template <typename Container, size_t Length>
+    void benchTinyLists(Bench::State& state)
+    {
+        const size_t n = state.length();
+        const size_t listCount = std::max<size_t>(1, n / Length);
+        const std::vector<int> values = makeValues<int>(Length);
+
+        const size_t allocationsBefore = AllocationCounter::allocations;
+        size_t iterations = 0;
+        size_t heapBytes = 0;
+
+        while (state.keepRunning())
+        {
+            std::vector<Container> lists(listCount);
+            const size_t bytesBefore = AllocationCounter::liveBytes;
+
+            for (Container& list : lists) {
+                fill(list, values);
+            }
+
+            heapBytes = AllocationCounter::liveBytes - bytesBefore;
+
+            long long sum = 0;
+
+            for (const Container& list : lists)
+            {
+                for (int value : list) {
+                    sum += value;
+                }
+            }
+
+            Bench::doNotOptimize(sum);
+            ++iterations;
+        }
+
+        state.setItemsPerIteration(listCount * Length);
+        state.setCounter("allocations_per_list", static_cast<double>(AllocationCounter::allocations - allocationsBefore) /
+                                                 static_cast<double>(std::max<size_t>(1, iterations) * listCount));
+        state.setCounter("object_bytes", static_cast<double>(sizeof(Container)));
+        state.setCounter("bytes_per_list", static_cast<double>(sizeof(Container)) +
+                                           static_cast<double>(heapBytes) / static_cast<double>(listCount));
+    }
+
+    template <size_t Length>
+    void registerTinyListsOf(size_t n)
+    {
+        using Counting = CountingAllocator<int>;
+        const std::string operation = "tinyLists" + std::to_string(Length);
+
+        Bench::registerBenchmark(operation, "LinkedList", "int", n, benchTinyLists<Containers::LinkedList<int, Counting>, Length>);
+        Bench::registerBenchmark(operation, "SmallLinkedList<8>", "int", n,
+                                 benchTinyLists<Containers::SmallLinkedList<int, 8, Counting>, Length>);
+        Bench::registerBenchmark(operation, "std::forward_list", "int", n, benchTinyLists<std::forward_list<int, Counting>, Length>);
+    }
+
+    // Списки длины 2 и 6 помещаются во встроенное хранилище SmallLinkedList<8>, списки длины 12 - нет.
+    void registerTinyLists(size_t maxN)
+    {
+        for (size_t n : lengths(std::min<size_t>(maxN, 1000000)))
+        {
+            if (n < 100) {
+                continue;
+            }
+
+            registerTinyListsOf<2>(n);
+            registerTinyListsOf<6>(n);
+            registerTinyListsOf<12>(n);
+        }
+    }
+
+    // Task - задача планировщика, которую можно включить в IntrusiveLinkedList.
+    struct Task
+    {
+        std::uint64_t id = 0;
+        std::uint64_t runs = 0;
+        Containers::IntrusiveListHook<Task> hook;
+
+        bool operator==(const Task& other) const {
+            return id == other.id;
+        }
+
+        bool operator!=(const Task& other) const {
+            return id != other.id;
+        }
+    };
+
+    // Scheduler - способ хранения очереди задач.
+    enum class Scheduler { Intrusive, Owning, Pointers };
+
+    // SchedulerOperation - нагрузка на очередь.
+    enum class SchedulerOperation
+    {
+        RoundRobin,     // Взять задачу из начала очереди, выполнить и вернуть в конец.
+        Cancel          // Отменить задачу из середины очереди и снова поставить ее в конец.
+    };
+
+    /*  Очередь планировщика из n задач. Intrusive - IntrusiveLinkedList над задачами, которыми владеет
+        std::vector; Owning - LinkedList<Task> (задача перемещается в новый узел); Pointers - LinkedList<Task*>.
+        Отмена известной задачи у IntrusiveLinkedList - unlink() за O(1), у LinkedList - remove() за O(n).
+        Счетчик allocations_per_op - выделения памяти на одну операцию.  */
+    template <Scheduler Kind, SchedulerOperation Operation>
+    void benchScheduler(Bench::State& state)
+    {
+        constexpr size_t cancelsPerIteration = 1000;
+
+        using Counting = CountingAllocator<int>;
+
+        const size_t n = state.length();
+        const size_t operations = Operation == SchedulerOperation::RoundRobin ? n : cancelsPerIteration;
+
+        std::vector<Task> tasks(n);
+
+        for (size_t i = 0; i < n; ++i) {
+            tasks[i].id = i;
+        }
+
+        Containers::IntrusiveLinkedList<Task, &Task::hook> intrusive;
+        Containers::LinkedList<Task, Counting> owning;
+        Containers::LinkedList<Task*, Counting> pointers;
+
+        for (Task& task : tasks)
+        {
+            if constexpr (Kind == Scheduler::Intrusive) {
+                intrusive.pushBack(task);
+            }
+            else if constexpr (Kind == Scheduler::Owning) {
+                owning.pushBack(task);
+            }
+            else {
+                pointers.pushBack(&task);
+            }
+        }
+
+        std::mt19937_64 generator(7);
+        const size_t allocationsBefore = AllocationCounter::allocations;
+        size_t iterations = 0;
+
+        while (state.keepRunning())
+        {
+            for (size_t i = 0; i < operations; ++i)
+            {
+                if constexpr (Operation == SchedulerOperation::RoundRobin)
+                {
+                    if constexpr (Kind == Scheduler::Intrusive)
+                    {
+                        Task& task = intrusive.popFront();
+                        ++task.runs;
+                        intrusive.pushBack(task);
+                    }
+                    else if constexpr (Kind == Scheduler::Owning)
+                    {
+                        Task task = owning.popFront();
+                        ++task.runs;
+                        owning.pushBack(std::move(task));
+                    }
+                    else
+                    {
+                        Task* task = pointers.popFront();
+                        ++task->runs;
+                        pointers.pushBack(task);
+                    }
+                }
+                else
+                {
+                    // Отменяемая задача известна вызывающему (по индексу в пуле задач).
+                    Task& task = tasks[generator() % n];
+
+                    if constexpr (Kind == Scheduler::Intrusive)
+                    {
+                        intrusive.unlink(task);
+                        intrusive.pushBack(task);
+                    }
+                    else if constexpr (Kind == Scheduler::Owning)
+                    {
+                        owning.remove(task);
+                        owning.pushBack(task);
+                    }
+                    else
+                    {
+                        pointers.remove(&task);
+                        pointers.pushBack(&task);
+                    }
+                }
+            }
+
+            ++iterations;
+        }
+
+        state.setItemsPerIteration(operations);
+        state.setCounter("allocations_per_op", static_cast<double>(AllocationCounter::allocations - allocationsBefore) /
+                                               static_cast<double>(std::max<size_t>(1, iterations) * operations));
+    }
+
+    void registerSchedulers(size_t maxN)
+    {
+        for (size_t n : lengths(std::min<size_t>(maxN, 1000000)))
+        {
+            Bench::registerBenchmark("schedulerRoundRobin", "IntrusiveLinkedList", "task", n,
+                                     benchScheduler<Scheduler::Intrusive, SchedulerOperation::RoundRobin>);
+            Bench::registerBenchmark("schedulerRoundRobin", "LinkedList<Task>", "task", n,
+                                     benchScheduler<Scheduler::Owning, SchedulerOperation::RoundRobin>);
+            Bench::registerBenchmark("schedulerRoundRobin", "LinkedList<Task*>", "task", n,
+                                     benchScheduler<Scheduler::Pointers, SchedulerOperation::RoundRobin>);
+
+            // Отмена у LinkedList линейна, поэтому замеряется на длинах до 10^5.
+            if (n <= 100000)
+            {
+                Bench::registerBenchmark("schedulerCancel", "IntrusiveLinkedList", "task", n,
+                                         benchScheduler<Scheduler::Intrusive, SchedulerOperation::Cancel>);
+                Bench::registerBenchmark("schedulerCancel", "LinkedList<Task>", "task", n,
+                                         benchScheduler<Scheduler::Owning, SchedulerOperation::Cancel>);
+                Bench::registerBenchmark("schedulerCancel", "LinkedList<Task*>", "task", n,
+                                         benchScheduler<Scheduler::Pointers, SchedulerOperation::Cancel>);
+            }
+        }
+    }
+
+    // Pipeline - способ выполнить цепочку filter -> transform -> take.
+    enum class Pipeline { Materialized, Lazy, Generator };
+
+    /*  Цепочка "четные -> x * 3 + 1 -> первые n / 4 -> сумма" над списком длины n.
+        Materialized строит промежуточный список на каждом шаге, Lazy обходит views, Generator забирает
+        значения из views::generate. Счетчик allocations - выделения узлов за итерацию
+        (кадр сопрограммы генератора выделяется через operator new и в счетчик не входит).  */
+    template <Pipeline Kind>
+    void benchPipeline(Bench::State& state)
+    {
+        using Counting = CountingAllocator<int>;
+        using List = Containers::LinkedList<int, Counting>;
+
+        const size_t n = state.length();
+        const size_t count = n / 4;
+
+        List source;
+        fill(source, makeValues<int>(n));
+
+        auto isEven = [](int value) { return value % 2 == 0; };
+        auto scale = [](int value) { return value * 3 + 1; };
+
+        const size_t allocationsBefore = AllocationCounter::allocations;
+        size_t iterations = 0;
+
+        while (state.keepRunning())
+        {
+            long long sum = 0;
+
+            if constexpr (Kind == Pipeline::Materialized)
+            {
+                List filtered;
+                List transformed;
+                List taken;
+
+                for (int value : source)
+                {
+                    if (isEven(value)) {
+                        filtered.pushBack(value);
+                    }
+                }
+
+                for (int value : filtered) {
+                    transformed.pushBack(scale(value));
+                }
+
+                for (auto current = transformed.begin(); current != transformed.end() && taken.size() < count; ++current) {
+                    taken.pushBack(*current);
+                }
+
+                for (int value : taken) {
+                    sum += value;
+                }
+            }
+            else if constexpr (Kind == Pipeline::Lazy)
+            {
+                namespace views = Containers::views;
+
+                for (int value : source | views::filter(isEven) | views::transform(scale) | views::take(count)) {
+                    sum += value;
+                }
+            }
+            else
+            {
+#ifdef CONTAINERS_HAS_COROUTINES
+                namespace views = Containers::views;
+
+                auto generator = views::generate(source | views::filter(isEven) | views::transform(scale) | views::take(count));
+
+                while (generator.next()) {
+                    sum += generator.value();
+                }
+#endif
+            }
+
+            Bench::doNotOptimize(sum);
+            ++iterations;
+        }
+
+        state.setItemsPerIteration(n);
+        state.setCounter("allocations", static_cast<double>(AllocationCounter::allocations - allocationsBefore) /
+                                        static_cast<double>(std::max<size_t>(1, iterations)));
+    }
+
+    void registerPipelines(size_t maxN)
+    {
+        for (size_t n : lengths(maxN))
+        {
+            Bench::registerBenchmark("pipeline", "LinkedList(materialized)", "int", n, benchPipeline<Pipeline::Materialized>);
+            Bench::registerBenchmark("pipeline", "views", "int", n, benchPipeline<Pipeline::Lazy>);
+#ifdef CONTAINERS_HAS_COROUTINES
+            Bench::registerBenchmark("pipeline", "views::generate", "int", n, benchPipeline<Pipeline::Generator>);
+#endif
+        }
+    }
+
+    // MutexQueue - очередь под мьютексом с интерфейсом ConcurrentQueue (базовая линия для сравнения).
+    template <typename T>
+    class MutexQueue
+    {
+    private:
+        std::mutex mutex;
+        std::deque<T> items;
+
+    public:
+        void pushBack(const T& value)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            items.push_back(value);
+        }
+
+        template <typename InputIterator>
+        void pushBackBulk(InputIterator first, InputIterator last)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            items.insert(items.end(), first, last);
+        }
+
+        bool tryPopFront(T& out)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            if (items.empty()) {
+                return false;
+            }
+
+            out = std::move(items.front());
+            items.pop_front();
+            return true;
+        }
+
+        template <typename OutputIterator>
+        size_t tryPopFrontBulk(OutputIterator output, size_t maxCount)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            const size_t count = std::min(maxCount, items.size());
+
+            output = std::move(items.begin(), items.begin() + static_cast<std::ptrdiff_t>(count), output);
+            items.erase(items.begin(), items.begin() + static_cast<std::ptrdiff_t>(count));
+            return count;
+        }
+    };
+
+    // Размер пачки для pushBackBulk() / tryPopFrontBulk().
+    constexpr size_t queueBatch = 32;
+
+    /*  Пропускная способность очереди на threads потоках: половина потоков добавляет n элементов, половина - извлекает.
+        1.  Один поток попеременно добавляет и извлекает по queueBatch элементов (очередь без конкуренции).
+        2.  С Bulk = true элементы передаются пачками по queueBatch.  */
+    template <typename Queue, bool Bulk>
+    void benchQueue(Bench::State& state, size_t threads)
+    {
+        const size_t n = state.length();
+
+        if (threads == 1)
+        {
+            while (state.keepRunning())
+            {
+                Queue queue;
+                int buffer[queueBatch];
+
+                for (size_t first = 0; first < n; first += queueBatch)
+                {
+                    const size_t count = std::min(queueBatch, n - first);
+
+                    for (size_t i = 0; i < count; ++i) {
+                        buffer[i] = static_cast<int>(first + i);
+                    }
+
+                    if constexpr (Bulk)
+                    {
+                        queue.pushBackBulk(buffer, buffer + count);
+                        Bench::doNotOptimize(queue.tryPopFrontBulk(buffer, count));
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < count; ++i) {
+                            queue.pushBack(buffer[i]);
+                        }
+
+                        for (size_t i = 0; i < count; ++i) {
+                            Bench::doNotOptimize(queue.tryPopFront(buffer[i]));
+                        }
+                    }
+                }
+            }
+
+            state.setItemsPerIteration(n);
+            state.setCounter("producers", 1);
+            state.setCounter("consumers", 1);
+            state.setCounter("threads", 1);
+            return;
+        }
+
+        const size_t producers = threads / 2;
+        const size_t consumers = threads - producers;
+
+        while (state.keepRunning())
+        {
+            Queue queue;
+            std::atomic<size_t> consumed{0};
+            std::vector<std::thread> workers;
+
+            for (size_t p = 0; p < producers; ++p)
+            {
+                workers.emplace_back([&queue, n, p, producers]() {
+                    const size_t first = n * p / producers;
+                    const size_t last = n * (p + 1) / producers;
+                    std::vector<int> batch;
+
+                    for (size_t i = first; i < last; ++i)
+                    {
+                        if constexpr (Bulk)
+                        {
+                            batch.push_back(static_cast<int>(i));
+
+                            if (batch.size() == queueBatch || i + 1 == last)
+                            {
+                                queue.pushBackBulk(batch.begin(), batch.end());
+                                batch.clear();
+                            }
+                        }
+                        else {
+                            queue.pushBack(static_cast<int>(i));
+                        }
+                    }
+                });
+            }
+
+            for (size_t c = 0; c < consumers; ++c)
+            {
+                workers.emplace_back([&queue, &consumed, n]() {
+                    int buffer[queueBatch];
+
+                    while (consumed.load(std::memory_order_relaxed) < n)
+                    {
+                        size_t count = 0;
+
+                        if constexpr (Bulk) {
+                            count = queue.tryPopFrontBulk(buffer, queueBatch);
+                        }
+                        else {
+                            count = queue.tryPopFront(buffer[0]) ? 1 : 0;
+                        }
+
+                        if (count == 0) {
+                            std::this_thread::yield();
+                        }
+                        else {
+                            consumed.fetch_add(count, std::memory_order_relaxed);
+                        }
+                    }
+                });
+            }
+
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+        }
+
+        state.setItemsPerIteration(n);
+        state.setCounter("producers", static_cast<double>(producers));
+        state.setCounter("consumers", static_cast<double>(consumers));
+        state.setCounter("threads", static_cast<double>(threads));
+    }
+
+    // MutexOrderedSet - отсортированный LinkedList под мьютексом (базовая линия для ConcurrentOrderedSet).
+    template <typename T>
+    class MutexOrderedSet
+    {
+    private:
+        mutable std::mutex mutex;
+        Containers::LinkedList<T> list;
+
+        // Метод возвращает позицию первого элемента, не меньшего value, и показывает, равен ли он value.
+        size_t lowerBound(const T& value, bool& found) const
+        {
+            size_t index = 0;
+            found = false;
+
+            for (const T& current : list)
+            {
+                if (!(current < value))
+                {
+                    found = !(value < current);
+                    break;
+                }
+
+                ++index;
+            }
+
+            return index;
+        }
+
+    public:
+        bool insert(const T& value)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            bool found;
+            const size_t index = lowerBound(value, found);
+
+            if (found) {
+                return false;
+            }
+
+            list.emplaceAt(index, value);
+            return true;
+        }
+
+        bool remove(const T& value)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            bool found;
+            lowerBound(value, found);
+            return found && list.remove(value);
+        }
+
+        bool contains(const T& value) const
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            bool found;
+            lowerBound(value, found);
+            return found;
+        }
+    };
+
+    // SetWorkload - доля операций чтения в нагрузке на упорядоченное множество.
+    enum class SetWorkload
+    {
+        ReadHeavy,      // 90% contains, 5% insert, 5% remove.
+        WriteHeavy      // 20% contains, 40% insert, 40% remove.
+    };
+
+    /*  Нагрузка на упорядоченное множество с ключами из [0, n): множество заполнено наполовину,
+        threads потоков выполняют по setOperations случайных операций. Время - на одну операцию.  */
+    template <typename Set, SetWorkload Workload>
+    void benchOrderedSet(Bench::State& state, size_t threads)
+    {
+        constexpr size_t setOperations = 20000;
+        constexpr unsigned readPercent = Workload == SetWorkload::ReadHeavy ? 90 : 20;
+
+        const size_t n = state.length();
+        Set set;
+
+        for (size_t key = 0; key < n; key += 2) {
+            set.insert(static_cast<int>(key));
+        }
+
+        size_t round = 0;
+
+        while (state.keepRunning())
+        {
+            std::vector<std::thread> workers;
+
+            for (size_t t = 0; t < threads; ++t)
+            {
+                workers.emplace_back([&set, n, t, round]() {
+                    std::mt19937_64 random(round * 131 + t);
+                    size_t hits = 0;
+
+                    for (size_t i = 0; i < setOperations; ++i)
+                    {
+                        const int key = static_cast<int>(random() % n);
+                        const unsigned operation = static_cast<unsigned>(random() % 100);
+
+                        if (operation < readPercent) {
+                            hits += set.contains(key);
+                        }
+                        else if ((operation - readPercent) % 2 == 0) {
+                            hits += set.insert(key);
+                        }
+                        else {
+                            hits += set.remove(key);
+                        }
+                    }
+
+                    Bench::doNotOptimize(hits);
+                });
+            }
+
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+
+            ++round;
+        }
+
+        state.setItemsPerIteration(threads * setOperations);
+        state.setCounter("threads", static_cast<double>(threads));
+    }
+
+    // Масштабирование замеряется на 1, 2, 4, ... потоках (до числа аппаратных потоков).
+    void registerOrderedSets(size_t maxN)
+    {
+        const size_t hardware = std::max<size_t>(1, std::thread::hardware_concurrency());
+
+        for (size_t n : lengths(std::min<size_t>(maxN, 10000)))
+        {
+            if (n < 100) {
+                continue;
+            }
+
+            for (size_t threads = 1; ; threads = std::min(threads * 2, hardware))
+            {
+                const std::string suffix = "[threads=" + std::to_string(threads) + "]";
+
+                auto add = [&](const std::string& operation, const std::string& container, void (*body)(Bench::State&, size_t)) {
+                    Bench::registerBenchmark(operation, container + suffix, "int", n, [body, threads](Bench::State& state) {
+                        body(state, threads);
+                    });
+                };
+
+                add("setReadHeavy", "ConcurrentOrderedSet", benchOrderedSet<Containers::ConcurrentOrderedSet<int>, SetWorkload::ReadHeavy>);
+                add("setReadHeavy", "MutexOrderedSet", benchOrderedSet<MutexOrderedSet<int>, SetWorkload::ReadHeavy>);
+                add("setWriteHeavy", "ConcurrentOrderedSet", benchOrderedSet<Containers::ConcurrentOrderedSet<int>, SetWorkload::WriteHeavy>);
+                add("setWriteHeavy", "MutexOrderedSet", benchOrderedSet<MutexOrderedSet<int>, SetWorkload::WriteHeavy>);
+
+                if (threads == hardware) {
+                    break;
+                }
+            }
+        }
+    }
+
+    // Масштабирование замеряется на 1, 2, 4, ... потоках (до числа аппаратных потоков), как у registerOrderedSets().
+    void registerQueues()
+    {
+        constexpr size_t items = 1 << 16;
+        const size_t hardware = std::max<size_t>(1, std::thread::hardware_concurrency());
+
+        for (size_t threads = 1; ; threads = std::min(threads * 2, hardware))
+        {
+            const std::string suffix = "[threads=" + std::to_string(threads) + "]";
+
+            auto add = [&](const std::string& operation, const std::string& container, void (*body)(Bench::State&, size_t)) {
+                Bench::registerBenchmark(operation, container + suffix, "int", items, [body, threads](Bench::State& state) {
+                    body(state, threads);
+                });
+            };
+
+            add("queue", "ConcurrentQueue", benchQueue<Containers::ConcurrentQueue<int>, false>);
+            add("queueBulk", "ConcurrentQueue", benchQueue<Containers::ConcurrentQueue<int>, true>);
+            add("queue", "MutexQueue", benchQueue<MutexQueue<int>, false>);
+            add("queueBulk", "MutexQueue", benchQueue<MutexQueue<int>, true>);
+
+            if (threads == hardware) {
+                break;
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Bench::Options options;
+
+    try {
+        options = Bench::parseOptions(argc, argv);
+    }
+    catch (const std::invalid_argument& error)
+    {
+        std::cerr << error.what() << "\n" << Bench::usage();
+        return 2;
+    }
+
+    if (options.help)
+    {
+        std::cout << Bench::usage();
+        return 0;
+    }
+
+    registerBaselines<int>("int", options.maxN);
+    registerBaselines<Pod64>("pod64", options.maxN);
+    registerBaselines<std::string>("string", options.maxN);
+    registerVariants(options.maxN);
+    registerCompaction<int>("int", options.maxN);
+    registerCompaction<std::string>("string", options.maxN);
+    registerSnapshots<int>("int", options.maxN);
+    registerSnapshots<std::string>("string", options.maxN);
+    registerSplicing<int>("int", options.maxN);
+    registerSplicing<std::string>("string", options.maxN);
+    registerTeardown<int>("int", options.maxN);
+    registerTeardown<std::string>("string", options.maxN);
+    registerLoading<int>("int", options.maxN);
+    registerLoading<std::string>("string", options.maxN);
+    registerSimd<int>("int", options.maxN);
+    registerSimd<double>("double", options.maxN);
+    registerParallel(options.maxN);
+    registerFootprints(options.maxN);
+    registerPipelines(options.maxN);
+    registerTinyLists(options.maxN);
+    registerSchedulers(options.maxN);
+    registerOrderedSets(options.maxN);
+    registerQueues();
+
+    return Bench::runBenchmarks(options);
+}
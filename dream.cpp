@@ -1,559 +1,9972 @@
-#include <iostream>
-
-// Containers - пространство имен, предназначенное для хранения различных контейнеров.
-namespace Containers
-{
-    // LinkedList - шаблонный класс, описывающий структуру однонаправленного связанного списка.
-    template <typename T>
-    class LinkedList
-    {
-    private:
-        // ListNode - cтруктура узла.
-        template <typename Type>
-        struct ListNode
-        {
-            // Значение, хранящееся в узле.
-            Type value;
-
-            // Указатель на следующий узел списка.
-            ListNode<Type>* next;
-
-            ListNode(const Type& value) : value(value), next(nullptr) {}
-        };
-
-        // Размер списка на текущий момент.
-        size_t sizeOfList;
-
-        // Указатель на первый узел списка.
-        ListNode<T>* head;
-
-        // Указатель на последний узел списка.
-        ListNode<T>* tail;
-
-    public:
-        /*  Iterator - класс, описывающий структуру итератора 
-            (объекта, с помощью которого можно итерироваться по списку).  */
-        class Iterator
-        {
-        private:
-            // Указатель на узел, на который смотрит итератор.
-            ListNode<T>* pointerToNode;
-
-        public:
-            // Информация об итераторе для библиотеки <algorithm>:
-            using iterator_category = std::forward_iterator_tag;   // Тип итератора.
-            using value_type = T;                                  // Тип элемента.
-            using difference_type = std::ptrdiff_t;                // Разница между итераторами.
-            using pointer = T*;                                    // Указатель на элемент.
-            using reference = T&;                                  // Ссылка на элемент.
-
-            Iterator(ListNode<T>* somePointer) : pointerToNode(somePointer) {}
-
-            // Оператор разыменования - возвращает значение узла (на который смотрит итератор) по ссылке.
-            reference operator*() {
-                return pointerToNode->value;
-            }
-
-            // Оператор префиксного инкремента - передвигает итератор на следующий узел списка.
-            Iterator& operator++()
-            {
-                pointerToNode = pointerToNode->next;
-                return *this;
-            }
-
-            // Операторы сравнения - проверяют итераторы на равенство.
-            bool operator==(const Iterator& other) {
-                return pointerToNode == other.pointerToNode;
-            }
-
-            bool operator!=(const Iterator& other) {
-                return pointerToNode != other.pointerToNode;    
-            }
-        };
-
-        // Метод возвращает итератор, который смотрит на голову списка.
-        Iterator begin() const {
-            return Iterator(head);
-        }
-
-        /*  Метод возвращает итератор, который смотрит на узел, 
-            следующий за хвостом (это всегда nullptr).  */
-        Iterator end() const {
-            return Iterator(nullptr);
-        }
-
-        // Конструктор по умолчанию.
-        LinkedList() : sizeOfList(0), head(nullptr), tail(nullptr) {}
-
-        // Пользовательский конструктор.
-        LinkedList(const std::initializer_list<T>& list) : LinkedList()
-        {
-            for (const T& value: list) {
-                this->pushBack(value);
-            }
-        }
-
-        // Конструктор глубокого копирования.
-        LinkedList(const LinkedList<T>& other) 
-        : sizeOfList(other.sizeOfList), head(nullptr), tail(nullptr)
-        {
-            // 1. Если другой список пустой - инициализации выше достаточно.
-            if (other.isEmpty()) {
-                return;
-            }
-
-            // В противном случае:
-
-            /* 2.   Создаю новый узел со значением головы другого списка. 
-                    Голову и хвост текущего списка направляю на созданный узел.   */
-            head = new ListNode<T>(other.head->value);
-            tail = head;
-
-            // 3. Создаю временный указатель на узлы другого списка (для итерации по ним).
-            ListNode<T>* currentOther = other.head->next;
-
-            /* 4.   Итерируюсь по узлам другого списка, беру из них значения, 
-                    и с помощью метода pushBack() добавляю новые узлы c взятыми значениями в свой список.  */
-            while (currentOther != nullptr)
-            {
-                this->pushBack(currentOther->value);
-                currentOther = currentOther->next;
-            }
-        }
-
-        // Конструктор копирования перемещением.
-        LinkedList(LinkedList<T>&& other) noexcept
-        : sizeOfList(other.sizeOfList), head(other.head), tail(other.tail)
-        {
-            // 1. С помощью списка инициализации я забираю ресурсы у объекта other.
-
-            /* 2.   Для объекта other я обнуляю размер списка, указатели на голову и хвост.
-                    Благодаря данным манипуляциям, деструктор объекта other не сможет освободить 
-                    занимаемые им ресурсы (см. реализацию деструктора). 
-
-                    Это полностью корректно, так как данными ресурсами теперь владеет наш список.  */
-            other.sizeOfList = 0;
-            other.head = nullptr;
-            other.tail = nullptr;
-        }
-
-        // Деструктор.
-        ~LinkedList() {
-            this->clear();
-        }
-
-        // Оператор глубокого копирования.
-        LinkedList<T>& operator=(const LinkedList<T>& other)
-        {
-            // 1. Если произошла попытка самоприсваивания - ничего не делаю.
-            if (this == &other) {
-                return *this;
-            }
-
-            // В противном случае:
-
-            // 2. Очищаю свой список с помощью метода clear() (который грамотно удаляет все узлы).
-            this->clear();
-
-            /* 3.   Создаю новый узел со значением головы другого списка. 
-                    Голову и хвост текущего списка направляю на созданный узел.   */
-            head = new ListNode<T>(other.head->value);
-            tail = head;
-
-            // 4. Создаю временный указатель на узлы другого списка (для итерации по ним).
-            ListNode<T>* currentOther = other.head->next;
-
-            /* 5.   Итерируюсь по узлам другого списка, беру из них значения, 
-                    и с помощью метода pushBack() добавляю новые узлы c взятыми значениями в свой список.   */
-            while (currentOther != nullptr)
-            {
-                this->pushBack(currentOther->value);
-                currentOther = currentOther->next;
-            }
-
-            return *this;
-        }
-
-        // Оператор присваивания перемещением.
-        LinkedList<T>& operator=(LinkedList<T>&& other) noexcept
-        {
-            // 1. Если произошла попытка самоприсваивания - ничего не делаю.
-            if (this == &other) {
-                return *this;
-            }
-
-            // В противном случае:
-
-            // 2. Очищаю свой список с помощью метода clear() (который грамотно удаляет все узлы).
-            this->clear();
-
-            // 3. Забираю ресурсы, которыми владеет объект other. 
-            sizeOfList = other.sizeOfList;
-            head = other.head;
-            tail = other.tail;
-
-            /* 4.   Для объекта other я обнуляю размер списка, указатели на голову и хвост.
-                    Благодаря данным манипуляциям, деструктор объекта other не сможет освободить 
-                    занимаемые им ресурсы (см. реализацию деструктора). 
-
-                    Это полностью корректно, так как данными ресурсами теперь владеет наш список.  */
-            other.sizeOfList = 0;
-            other.head = nullptr;
-            other.tail = nullptr;
-
-            return *this;
-        }
-
-        /*
-        1.  Данный оператор предоставляет доступ к элементам списка по индексу (аналогично массивам).
-        2.  Доступна как положительная индексация (первый элемент имеет индекс 0),
-        так и отрицательная (последний элемент имеет индекс -1).
-        3.  Оператор возвращает элемент по ссылке.
-        4.  Важно! Обращение к элементу по индексу имеет сложность O(n), что может быть неэффективно для больших списков.
-        */
-        T& operator[](int index)
-        {
-            // 1. Если значение индекса выходит за пределы - выбрасываю исключение.
-            if (index < -int(sizeOfList) || index >= int(sizeOfList)) {
-                throw std::out_of_range("Error! The index is out of range.");
-            }
-
-            // 2. Создаю временный указатель, с помощью которого буду итерироваться по списку.
-            ListNode<T>* tempPtr = head;
-
-            // 3. Итерируюсь по списку, нахожу нужный мне узел и возвращаю его значение по ссылке.
-            for (int i = 0; i < sizeOfList * (index < 0) + index; ++i) {
-                tempPtr = tempPtr->next;
-            }
-
-            return tempPtr->value;
-        }
-
-        /*  Метод показывает, является ли список пустым.
-            Возвращает соответствующее булевое значение.  */
-        bool isEmpty() const {
-            return head == nullptr;
-        }
-
-        // Метод возвращает длину списка на текущий момент.
-        size_t size() const {
-            return sizeOfList;
-        }
-
-        // Метод возвращает значение первого узла списка по ссылке.
-        T& front() const
-        {
-            // Если список пустой - невозможно обратиться к первому узлу (выбрасываю исключение).
-            if (head == nullptr) {
-                throw std::runtime_error("Error! The list is empty - you cannot refer to the first element.");
-            }
-
-            return head->value;
-        }
-
-        // Метод возвращает значение последнего узла списка по ссылке.
-        T& back() const
-        {
-            // Если список пустой - невозможно обратиться к последнему узлу (выбрасываю исключение).
-            if (head == nullptr) {
-                throw std::runtime_error("Error! The list is empty - you cannot refer to the last element.");
-            }
-
-            return tail->value;
-        }
-
-        // Метод выводит значения всех узлов в порядке их расположения в списке.
-        void print() const
-        {
-            ListNode<T>* tempPtr = head;
-
-            while (tempPtr != nullptr)
-            {
-                std::cout << tempPtr->value << ' ';
-                tempPtr = tempPtr->next;
-            }
-
-            std::cout << '\n';
-        }
-
-        /*  Метод ищет первый узел со значением value и возвращает указатель 
-            на значение этого узла. Если узел не найден - возвращает nullptr.  */
-        T* find(const T& value) const
-        {
-            ListNode<T>* tempPtr = head;
-
-            while (tempPtr != nullptr)
-            {
-                if (tempPtr->value == value) {
-                    return &tempPtr->value;
-                }
-
-                tempPtr = tempPtr->next;
-            }
-
-            return nullptr;
-        }
-
-        /*  Метод проверяет, есть ли в списке узел со значением value.
-            Возвращает соответствующее булевое значение.  */
-        bool contains(const T& value) const {
-            return find(value) != nullptr;
-        }
-
-        /*  Метод сортирует список, используя пузырьковую сортировку.
-            Важно! Данный алгоритм имеет сложность O(n^2), что может быть неэффективно для больших списков.  */
-        void sort()
-        {
-            // 1. Если в списке меньше 2-х элементов - сортировать ничего не нужно.
-            if (sizeOfList < 2) {
-                return;
-            }
-
-            // Длина списка как минимум 1.
-            bool isSwapped = false;
-
-            // 2. Сортирую список.
-            do
-            {
-                isSwapped = false;
-                ListNode<T>* current = head;
-
-                while (current->next)
-                {
-                    if (current->value > current->next->value)
-                    {
-                        std::swap(current->value, current->next->value);
-                        isSwapped = true;
-                    }
-
-                    current = current->next;
-                }
-
-            } while (isSwapped);
-        }
-
-        // Метод полностью очищает список.
-        void clear()
-        {
-            /*  - Пока список не пустой -> циклично удаляю первый узел.
-                - Стоит отметить, что я использую именно метод popFront(), т.к. он удаляет 
-                узел со сложностью O(1). Если бы я использовал метод popBack(), сложность удаления 
-                одного узла возрасла бы до O(n) - что неээфективно.  */ 
-            while (!isEmpty()) {
-                popFront();
-            }
-        }
-
-        /*  Метод удаляет первый узел со значением valueToRemove.
-            Возвращает true, если узел с соответствующим значением был найден и удалён, иначе - false.  */
-        bool remove(const T& valueToRemove)
-        {
-            // 1. Если список пустой - невозможно ничего удалить (возвращаю false).
-            if (head == nullptr) {
-                return false;
-            }
-
-            // 2. Если нужно удалить первый элемент:
-            if (head->value == valueToRemove)
-            {
-                popFront();
-                return true;
-            }
-
-            // В противном случае:
-
-            // 3. Создаю временный указатель для итерации по списку (сначала tempPtr указывает на первый узел).
-            ListNode<T>* tempPtr = head;
-
-            /* 4. Данный цикл закончится в двух случаях:
-                1) Указатель tempPtr указывает на последний узел списка.
-                2) Следующий узел после tempPtr содержит значение, которое необходимо удалить. */
-            while (tempPtr->next != nullptr && tempPtr->next->value != valueToRemove) {
-                tempPtr = tempPtr->next;
-            }
-
-            /* ОБЪЯСНЕНИЕ ПУНКТА 4.
-
-            ПЕРВЫЙ СЛУЧАЙ:
-            - Цикл заканчивается, когда tempPtr->next == nullptr.
-            - Это означает, что tempPtr указывает на последний узел списка.
-            - В этом случае, значение valueToRemove не было найдено в оставшейся части списка.
-
-            ВТОРОЙ СЛУЧАЙ:
-            - Цикл заканчивается, когда tempPtr->next->value == valueToRemove.
-            - Это означает, что следующий узел после tempPtr содержит значение, которое необходимо удалить.
-            - В этом случае, tempPtr является предыдущим узлом по отношению к узлу, который необходимо удалить. */
-
-            // 5. Если я вышел из цикла из-за первого случая -> значит, я ничего не нашел -> возвращаю false.
-            if (tempPtr->next == nullptr) {
-                return false;
-            }
-
-            // Если я зашел сюда, значит узел, следующий за tempPtr, необходимо удалить.
-
-            // 6. Создаю указатель на узел, который необходимо удалить.
-            ListNode<T>* nodeToRemove = tempPtr->next;
-
-            // 7. Теперь текущий узел должен показывать на узел, на который показывал удаляемый узел.
-            tempPtr->next = nodeToRemove->next;
-
-            // 8. Удаляю узел со значением valueToRemove.
-            delete nodeToRemove;
-
-            // 9. Если я удалил последний узел, то необходимо обновить хвост.
-            if (tempPtr->next == nullptr) {
-                tail = tempPtr;
-            }
-
-            --sizeOfList;
-
-            return true;
-        }
-
-        /*  Метод удаляет все узлы со значением valueToRemove.
-            Возвращает true, если хотя бы один узел был удалён, иначе - false. */
-        bool removeAll(const T& valueToRemove)
-        {
-            bool flag = false;
-
-            while (contains(valueToRemove)) 
-            {
-                flag = true;
-                remove(valueToRemove);
-            }
-
-            return flag;
-        }
-
-        // Метод добавляет новый элемент в начало списка.
-        void pushFront(const T& value)
-        {
-            // 1. Создаю новый узел и получаю на него указатель.
-            ListNode<T>* newNode = new ListNode<T>(value);
-
-            // 2. Новый узел должен показывать на первый узел списка.
-            newNode->next = head;
-
-            // 3. Голова, в свою очередь, теперь должна показывать на новый узел.
-            head = newNode;
-
-            // 4. Если список был пустым - хвост должен показывать на новый узел.
-            if (tail == nullptr) {
-                tail = newNode;
-            }
-
-            ++sizeOfList;
-        }
-
-        // Метод добавляет новый элемент в конец списка.
-        void pushBack(const T& value)
-        {
-            // 1. Создаю новый узел и получаю на него указатель.
-            ListNode<T>* newNode = new ListNode<T>(value);
-
-            // 2. Если список пустой - новый узел становится как головой, так и хвостом.
-            if (head == nullptr)
-            {
-                head = newNode;
-                tail = newNode;
-            }
-            else
-            {
-                // Если список не пустой:
-
-                // 3. Последний узел списка должен показывать на новый узел.
-                tail->next = newNode;
-
-                /* 3.1. Указатель на хвост должен показывать на новый узел 
-                        (так как теперь новый узел - последний в списке). */
-                tail = newNode;
-            }
-
-            ++sizeOfList;
-        }
-
-        /*  Метод удаляет первый элемент из списка.
-            Возвращает значение удаленного элемента.  */
-        T popFront()
-        {
-            /* 1.   Проверяю список на пустоту. 
-                    Если список пустой - невозможно ничего удалить (выбрасываю исключение).   */
-            if (head == nullptr) {
-                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
-            }
-        
-            // 2. Сохраняю значение удаляемого узла.
-            T deleted = head->value;
-        
-            // 3. Сохраняю указатель на второй узел (так как он впоследствии станет первым).
-            ListNode<T>* second = head->next;
-        
-            // 4. Удаляю первый узел.
-            delete head;
-        
-            // 5. Направляю указатель на голову на второй узел.
-            head = second;
-        
-            // 6. Если список стал пустым - обнуляю указатель на хвост.
-            if (head == nullptr) {
-                tail = nullptr;
-            }
-        
-            --sizeOfList;
-        
-            return deleted;
-        }
-
-        /*  Метод удаляет последний элемент из списка.
-            Возвращает значение удаленного элемента.  */
-        T popBack()
-        {
-            /* 1.   Проверяю список на пустоту. 
-                    Если список пустой - невозможно ничего удалить (выбрасываю исключение).   */
-            if (head == nullptr) {
-                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
-            }
-        
-            // 2. Переменная для хранения значения удаляемого узла.
-            T deleted;
-        
-            // 3. Если в списке только один узел:
-            if (head == tail)
-            {
-                // 3.1. Сохраняю значение удаляемого узла.
-                deleted = head->value;
-        
-                // 3.2. Удаляю узел и обнуляю указатели.
-                delete head;
-                head = nullptr;
-                tail = nullptr;
-            }
-            else
-            {
-                // 4. Если узлов больше одного:
-        
-                // 4.1. Ищу предпоследний узел.
-                ListNode<T>* tempPtr = head;
-                while (tempPtr->next != tail) {
-                    tempPtr = tempPtr->next;
-                }
-        
-                // Здесь tempPtr указывает на предпоследний узел.
-        
-                // 4.2. Сохраняю значение последнего узла.
-                deleted = tail->value;
-        
-                // 4.3. Удаляю последний узел.
-                delete tail;
-        
-                // 4.4. Обновляю указатель на хвост и обнуляю указатель хвоста.
-                tail = tempPtr;
-                tail->next = nullptr;
-            }
-        
-            --sizeOfList;
-        
-            return deleted;
-        }
-    };
-}
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// На POSIX-системах доступно отображение файлов в память (MappedListView).
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CONTAINERS_HAS_MMAP 1
+#endif
+
+// В режиме C++20 доступен генератор на сопрограммах (views::Generator).
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#define CONTAINERS_HAS_COROUTINES 1
+#endif
+
+// На x86 с GCC и Clang поиск по числовым элементам векторизуется (SSE2 / AVX2 с выбором во время выполнения).
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define CONTAINERS_HAS_X86_SIMD 1
+#endif
+
+/*  CONTAINERS_INTRUSIVE_CHECKS - проверки IntrusiveLinkedList (повторная вставка элемента, удаление чужого элемента).
+    По умолчанию включены в сборке без NDEBUG. Значение должно совпадать во всех единицах трансляции
+    (от него зависит размер IntrusiveListHook).  */
+#ifndef CONTAINERS_INTRUSIVE_CHECKS
+#ifdef NDEBUG
+#define CONTAINERS_INTRUSIVE_CHECKS 0
+#else
+#define CONTAINERS_INTRUSIVE_CHECKS 1
+#endif
+#endif
+
+// CONTAINERS_PREFETCH - подсказка процессору заранее загрузить в кэш память по адресу address.
+#if defined(__GNUC__) || defined(__clang__)
+#define CONTAINERS_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define CONTAINERS_PREFETCH(address) ((void)0)
+#endif
+
+// Containers - пространство имен, предназначенное для хранения различных контейнеров.
+namespace Containers
+{
+    /*  execution - политики выполнения для алгоритмов контейнеров (по аналогии с std::execution).
+        Собственные политики используются вместо <execution>, так как стандартная библиотека
+        на ряде платформ требует для него линковки с TBB.  */
+    namespace execution
+    {
+        // Последовательное выполнение.
+        struct sequenced_policy {};
+
+        // Параллельное выполнение на нескольких потоках.
+        struct parallel_policy {};
+
+        inline constexpr sequenced_policy seq{};
+        inline constexpr parallel_policy par{};
+
+        // Признак того, что тип является политикой выполнения.
+        template <typename T>
+        struct is_execution_policy : std::false_type {};
+
+        template <>
+        struct is_execution_policy<sequenced_policy> : std::true_type {};
+
+        template <>
+        struct is_execution_policy<parallel_policy> : std::true_type {};
+
+        template <typename T>
+        inline constexpr bool is_execution_policy_v = is_execution_policy<std::decay_t<T>>::value;
+    }
+
+    /*  simd - векторные ядра поиска по непрерывному массиву числовых значений (используются UnrolledLinkedList).
+        1.  Ядро сравнивает сразу 16 (SSE2) или 32 (AVX2) байта значений. Набор инструкций выбирается
+        во время выполнения по возможностям процессора, на других платформах работает скалярное ядро.
+        2.  Числа с плавающей точкой сравниваются так же, как оператором == (NaN не равен ничему, -0.0 == 0.0).
+        3.  setMaxLevel() ограничивает набор инструкций (например, чтобы сравнить уровни в бенчмарках).  */
+    namespace simd
+    {
+        // Level - набор инструкций, которым пользуются ядра.
+        enum class Level { Scalar, SSE2, AVX2 };
+
+        // Признак того, что поиск по значениям типа T векторизуется.
+        template <typename T>
+        inline constexpr bool is_vectorizable_v = std::is_arithmetic_v<T> && !std::is_same_v<T, long double> &&
+                                                  (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+        // Ядро поиска: возвращает номер первого значения, равного value, среди count значений (count - если такого нет).
+        template <typename T>
+        using FindKernel = size_t (*)(const T* values, size_t count, const T& value);
+
+        // Ядро подсчета: возвращает количество значений, равных value, среди count значений.
+        template <typename T>
+        using CountKernel = size_t (*)(const T* values, size_t count, const T& value);
+
+        template <typename T>
+        size_t findScalar(const T* values, size_t count, const T& value)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (values[i] == value) {
+                    return i;
+                }
+            }
+
+            return count;
+        }
+
+        template <typename T>
+        size_t countScalar(const T* values, size_t count, const T& value)
+        {
+            size_t result = 0;
+
+            for (size_t i = 0; i < count; ++i) {
+                result += values[i] == value ? 1 : 0;
+            }
+
+            return result;
+        }
+
+#ifdef CONTAINERS_HAS_X86_SIMD
+        // Метод возвращает биты значения value в виде целого числа того же размера (для размножения по регистру).
+        template <typename T>
+        auto bitsOf(const T& value)
+        {
+            using Bits = std::conditional_t<sizeof(T) == 1, std::int8_t, std::conditional_t<sizeof(T) == 2, std::int16_t,
+                         std::conditional_t<sizeof(T) == 4, std::int32_t, std::int64_t>>>;
+
+            Bits bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        /*  Метод возвращает количество единичных битов в маске.
+            popcnt не входит ни в SSE2, ни в AVX2, поэтому биты считаются арифметикой над словом.  */
+        inline unsigned bitCount(std::uint32_t mask)
+        {
+            mask = mask - ((mask >> 1) & 0x55555555u);
+            mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+            return (((mask + (mask >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+        }
+
+        /*  Sse2, Avx2 - операции над одним векторным регистром для ядер соответствующего набора инструкций.
+            Сравнение возвращает маску, в которой каждому байту совпавшего значения соответствует единичный бит.  */
+        struct Sse2
+        {
+            using Register = __m128i;
+
+            static constexpr size_t bytes = 16;
+
+            __attribute__((target("sse2"))) static Register load(const void* address) {
+                return _mm_loadu_si128(static_cast<const Register*>(address));
+            }
+
+            template <typename T>
+            __attribute__((target("sse2"))) static Register broadcast(const T& value)
+            {
+                if constexpr (sizeof(T) == 1) {
+                    return _mm_set1_epi8(bitsOf(value));
+                }
+                else if constexpr (sizeof(T) == 2) {
+                    return _mm_set1_epi16(bitsOf(value));
+                }
+                else if constexpr (sizeof(T) == 4) {
+                    return _mm_set1_epi32(bitsOf(value));
+                }
+                else {
+                    return _mm_set1_epi64x(bitsOf(value));
+                }
+            }
+
+            template <typename T>
+            __attribute__((target("sse2"))) static std::uint32_t equalMask(Register block, Register needle)
+            {
+                Register equal;
+
+                if constexpr (std::is_same_v<T, float>) {
+                    equal = _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(block), _mm_castsi128_ps(needle)));
+                }
+                else if constexpr (std::is_same_v<T, double>) {
+                    equal = _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(block), _mm_castsi128_pd(needle)));
+                }
+                else if constexpr (sizeof(T) == 1) {
+                    equal = _mm_cmpeq_epi8(block, needle);
+                }
+                else if constexpr (sizeof(T) == 2) {
+                    equal = _mm_cmpeq_epi16(block, needle);
+                }
+                else if constexpr (sizeof(T) == 4) {
+                    equal = _mm_cmpeq_epi32(block, needle);
+                }
+                else
+                {
+                    // В SSE2 нет сравнения 64-битных чисел: значения равны, если равны обе их 32-битные половины.
+                    const Register halves = _mm_cmpeq_epi32(block, needle);
+                    equal = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+                }
+
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(equal));
+            }
+        };
+
+        struct Avx2
+        {
+            using Register = __m256i;
+
+            static constexpr size_t bytes = 32;
+
+            __attribute__((target("avx2"))) static Register load(const void* address) {
+                return _mm256_loadu_si256(static_cast<const Register*>(address));
+            }
+
+            template <typename T>
+            __attribute__((target("avx2"))) static Register broadcast(const T& value)
+            {
+                if constexpr (sizeof(T) == 1) {
+                    return _mm256_set1_epi8(bitsOf(value));
+                }
+                else if constexpr (sizeof(T) == 2) {
+                    return _mm256_set1_epi16(bitsOf(value));
+                }
+                else if constexpr (sizeof(T) == 4) {
+                    return _mm256_set1_epi32(bitsOf(value));
+                }
+                else {
+                    return _mm256_set1_epi64x(bitsOf(value));
+                }
+            }
+
+            template <typename T>
+            __attribute__((target("avx2"))) static std::uint32_t equalMask(Register block, Register needle)
+            {
+                Register equal;
+
+                if constexpr (std::is_same_v<T, float>) {
+                    equal = _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(block), _mm256_castsi256_ps(needle), _CMP_EQ_OQ));
+                }
+                else if constexpr (std::is_same_v<T, double>) {
+                    equal = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(block), _mm256_castsi256_pd(needle), _CMP_EQ_OQ));
+                }
+                else if constexpr (sizeof(T) == 1) {
+                    equal = _mm256_cmpeq_epi8(block, needle);
+                }
+                else if constexpr (sizeof(T) == 2) {
+                    equal = _mm256_cmpeq_epi16(block, needle);
+                }
+                else if constexpr (sizeof(T) == 4) {
+                    equal = _mm256_cmpeq_epi32(block, needle);
+                }
+                else {
+                    equal = _mm256_cmpeq_epi64(block, needle);
+                }
+
+                return static_cast<std::uint32_t>(_mm256_movemask_epi8(equal));
+            }
+        };
+
+        /*  Ядра SSE2 и AVX2 (функции с атрибутом target, поэтому они генерируются макросом для каждого набора инструкций).
+            1.  nextMask() возвращает маску совпадений для очередного вектора значений, начиная с values[position].
+            Хвост массива короче вектора проверяется окном, выровненным по концу массива: уже проверенные
+            значения окна отбрасываются из маски. Возвращает false, если проверять больше нечего.
+            2.  Массивы короче одного вектора целиком проверяются скалярно.  */
+#define CONTAINERS_SIMD_KERNELS(Isa, targetName)                                                                \
+        template <typename T>                                                                                   \
+        __attribute__((target(targetName), always_inline)) inline bool nextMask##Isa(                         \
+            const T* values, size_t count, typename Isa::Register needle,                                       \
+            size_t& position, size_t& start, std::uint32_t& mask)                                               \
+        {                                                                                                       \
+            constexpr size_t lanes = Isa::bytes / sizeof(T);                                                    \
+                                                                                                                \
+            if (position + lanes <= count)                                                                      \
+            {                                                                                                   \
+                start = position;                                                                               \
+                position += lanes;                                                                              \
+            }                                                                                                   \
+            else if (position < count)                                                                          \
+            {                                                                                                   \
+                start = count - lanes;                                                                          \
+                mask = ~std::uint32_t(0) << ((position - start) * sizeof(T));                                   \
+                position = count;                                                                               \
+                mask &= Isa::template equalMask<T>(Isa::load(values + start), needle);                          \
+                return true;                                                                                    \
+            }                                                                                                   \
+            else {                                                                                              \
+                return false;                                                                                   \
+            }                                                                                                   \
+                                                                                                                \
+            mask = Isa::template equalMask<T>(Isa::load(values + start), needle);                               \
+            return true;                                                                                        \
+        }                                                                                                       \
+                                                                                                                \
+        template <typename T>                                                                                   \
+        __attribute__((target(targetName))) size_t find##Isa(const T* values, size_t count, const T& value)    \
+        {                                                                                                       \
+            if (count < Isa::bytes / sizeof(T)) {                                                               \
+                return findScalar(values, count, value);                                                        \
+            }                                                                                                   \
+                                                                                                                \
+            const typename Isa::Register needle = Isa::broadcast(value);                                        \
+                                                                                                                \
+            size_t position = 0, start = 0;                                                                     \
+            std::uint32_t mask = 0;                                                                             \
+                                                                                                                \
+            while (nextMask##Isa(values, count, needle, position, start, mask))                                 \
+            {                                                                                                   \
+                if (mask != 0) {                                                                                \
+                    return start + size_t(__builtin_ctz(mask)) / sizeof(T);                                     \
+                }                                                                                               \
+            }                                                                                                   \
+                                                                                                                \
+            return count;                                                                                       \
+        }                                                                                                       \
+                                                                                                                \
+        template <typename T>                                                                                   \
+        __attribute__((target(targetName))) size_t count##Isa(const T* values, size_t count, const T& value)   \
+        {                                                                                                       \
+            if (count < Isa::bytes / sizeof(T)) {                                                               \
+                return countScalar(values, count, value);                                                       \
+            }                                                                                                   \
+                                                                                                                \
+            const typename Isa::Register needle = Isa::broadcast(value);                                        \
+                                                                                                                \
+            size_t position = 0, start = 0, result = 0;                                                         \
+            std::uint32_t mask = 0;                                                                             \
+                                                                                                                \
+            while (nextMask##Isa(values, count, needle, position, start, mask)) {                               \
+                result += bitCount(mask) / sizeof(T);                                                           \
+            }                                                                                                   \
+                                                                                                                \
+            return result;                                                                                      \
+        }
+
+        CONTAINERS_SIMD_KERNELS(Sse2, "sse2")
+        CONTAINERS_SIMD_KERNELS(Avx2, "avx2")
+
+#undef CONTAINERS_SIMD_KERNELS
+#endif
+
+        // Метод определяет лучший набор инструкций, который поддерживает процессор.
+        inline Level detectLevel()
+        {
+#ifdef CONTAINERS_HAS_X86_SIMD
+            __builtin_cpu_init();
+
+            if (__builtin_cpu_supports("avx2")) {
+                return Level::AVX2;
+            }
+
+            if (__builtin_cpu_supports("sse2")) {
+                return Level::SSE2;
+            }
+#endif
+            return Level::Scalar;
+        }
+
+        // Метод возвращает набор инструкций процессора (определяется один раз).
+        inline Level supportedLevel()
+        {
+            static const Level level = detectLevel();
+            return level;
+        }
+
+        inline std::atomic<Level>& maxLevel()
+        {
+            static std::atomic<Level> level{Level::AVX2};
+            return level;
+        }
+
+        // Метод ограничивает набор инструкций ядер уровнем level (не выше supportedLevel()).
+        inline void setMaxLevel(Level level) {
+            maxLevel().store(level, std::memory_order_relaxed);
+        }
+
+        // Метод возвращает набор инструкций, которым сейчас пользуются ядра.
+        inline Level activeLevel() {
+            return std::min(supportedLevel(), maxLevel().load(std::memory_order_relaxed));
+        }
+
+        // Метод возвращает ядро поиска для типа T (векторное - только для числовых типов).
+        template <typename T>
+        FindKernel<T> findKernel()
+        {
+#ifdef CONTAINERS_HAS_X86_SIMD
+            if constexpr (is_vectorizable_v<T>)
+            {
+                switch (activeLevel())
+                {
+                case Level::AVX2:
+                    return &findAvx2<T>;
+                case Level::SSE2:
+                    return &findSse2<T>;
+                default:
+                    break;
+                }
+            }
+#endif
+            return &findScalar<T>;
+        }
+
+        // Метод возвращает ядро подсчета для типа T (векторное - только для числовых типов).
+        template <typename T>
+        CountKernel<T> countKernel()
+        {
+#ifdef CONTAINERS_HAS_X86_SIMD
+            if constexpr (is_vectorizable_v<T>)
+            {
+                switch (activeLevel())
+                {
+                case Level::AVX2:
+                    return &countAvx2<T>;
+                case Level::SSE2:
+                    return &countSse2<T>;
+                default:
+                    break;
+                }
+            }
+#endif
+            return &countScalar<T>;
+        }
+    }
+
+    /*  NodePool - пул блоков памяти небольшого фиксированного размера (slab + free-list).
+        1.  Память запрашивается у системы крупными чанками, а блоки нарезаются из них подряд,
+        поэтому узлы, созданные друг за другом, лежат в памяти рядом.
+        2.  Освобожденный блок не возвращается системе, а попадает в список свободных блоков
+        своего размерного класса и выдается повторно при следующем запросе.
+        3.  Вся память возвращается системе в деструкторе пула (или вызовом release()).
+        Блоки, которые пул не нарезает (слишком крупные или сильно выровненные), выделяются через operator new
+        с заголовком и связываются в отдельный список, поэтому release() освобождает и их.
+        4.  Важно! Пул не является потокобезопасным: списки, разделяющие один пул,
+        должны использоваться из одного потока.  */
+    class NodePool
+    {
+    private:
+        // FreeBlock - освобожденный блок (указатель на следующий свободный блок хранится прямо в нем).
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        // Chunk - заголовок чанка (чанки связаны в список, чтобы их можно было освободить).
+        struct Chunk
+        {
+            Chunk* next;
+        };
+
+        // LargeBlock - заголовок блока, выделенного через operator new (двусвязный список для удаления за O(1)).
+        struct LargeBlock
+        {
+            LargeBlock* prev;
+            LargeBlock* next;
+            size_t alignment;
+
+            // Размер памяти, выделенной под блок вместе с заголовком.
+            size_t size;
+        };
+
+        // Шаг размерных классов (все блоки выровнены как минимум по этой границе).
+        static constexpr size_t granularity = alignof(std::max_align_t);
+
+        // Максимальный размер блока, который обслуживает пул. Более крупные запросы уходят в operator new.
+        static constexpr size_t maxBlockSize = 512;
+
+        // Количество размерных классов.
+        static constexpr size_t classCount = maxBlockSize / granularity;
+
+        // Размер одного чанка в байтах.
+        size_t chunkSize;
+
+        // Списки свободных блоков для каждого размерного класса.
+        FreeBlock* freeLists[classCount];
+
+        // Список всех выделенных чанков.
+        Chunk* chunks;
+
+        // Границы еще не нарезанной части текущего чанка.
+        char* bumpPointer;
+        char* bumpEnd;
+
+        // Список блоков, выделенных через operator new.
+        LargeBlock* largeBlocks;
+
+        // Память, полученная пулом через operator new и еще не возвращенная (чанки и крупные блоки).
+        size_t reserved;
+
+        // Количество вызовов operator new за все время жизни пула.
+        size_t systemAllocations;
+
+        // Метод показывает, обслуживается ли запрос нарезкой чанков (иначе - через operator new).
+        static bool isSmall(size_t bytes, size_t alignment) {
+            return bytes != 0 && bytes <= maxBlockSize && alignment <= granularity;
+        }
+
+        // Метод возвращает размер заголовка крупного блока (кратен выравниванию, чтобы блок остался выровненным).
+        static size_t largeHeaderSize(size_t alignment)
+        {
+            const size_t align = std::max(alignment, alignof(LargeBlock));
+            return (sizeof(LargeBlock) + align - 1) / align * align;
+        }
+
+        // Метод выделяет крупный блок через operator new и добавляет его в список largeBlocks.
+        void* allocateLarge(size_t bytes, size_t alignment)
+        {
+            alignment = std::max(alignment, alignof(LargeBlock));
+            const size_t header = largeHeaderSize(alignment);
+
+            char* memory = static_cast<char*>(::operator new(header + bytes, std::align_val_t(alignment)));
+            LargeBlock* block = reinterpret_cast<LargeBlock*>(memory + header - sizeof(LargeBlock));
+
+            block->prev = nullptr;
+            block->next = largeBlocks;
+            block->alignment = alignment;
+            block->size = header + bytes;
+            reserved += block->size;
+            ++systemAllocations;
+
+            if (largeBlocks != nullptr) {
+                largeBlocks->prev = block;
+            }
+
+            largeBlocks = block;
+            return memory + header;
+        }
+
+        // Метод освобождает крупный блок block (заголовок блока уже исключен из списка или список сбрасывается).
+        static void freeLarge(LargeBlock* block)
+        {
+            const size_t alignment = block->alignment;
+            char* memory = reinterpret_cast<char*>(block + 1) - largeHeaderSize(alignment);
+            ::operator delete(memory, std::align_val_t(alignment));
+        }
+
+        // Метод возвращает номер размерного класса для блока размером bytes.
+        static size_t classOf(size_t bytes) {
+            return (bytes + granularity - 1) / granularity - 1;
+        }
+
+        // Метод выделяет новый чанк и делает его текущим.
+        void grow()
+        {
+            // 1. Заголовок чанка занимает первые granularity байт, чтобы блоки оставались выровненными.
+            char* memory = static_cast<char*>(::operator new(chunkSize));
+
+            Chunk* chunk = reinterpret_cast<Chunk*>(memory);
+            chunk->next = chunks;
+            chunks = chunk;
+            reserved += chunkSize;
+            ++systemAllocations;
+
+            // 2. Оставшаяся часть чанка становится областью для нарезки блоков.
+            bumpPointer = memory + granularity;
+            bumpEnd = memory + chunkSize;
+        }
+
+    public:
+        // Размер чанка по умолчанию (64 КиБ).
+        static constexpr size_t defaultChunkSize = 64 * 1024;
+
+        explicit NodePool(size_t chunkSize = defaultChunkSize)
+        : chunkSize(chunkSize < granularity + maxBlockSize ? granularity + maxBlockSize : chunkSize),
+          freeLists(), chunks(nullptr), bumpPointer(nullptr), bumpEnd(nullptr), largeBlocks(nullptr),
+          reserved(0), systemAllocations(0) {}
+
+        // Пул владеет чанками, поэтому копирование запрещено.
+        NodePool(const NodePool&) = delete;
+        NodePool& operator=(const NodePool&) = delete;
+
+        ~NodePool() {
+            release();
+        }
+
+        /*  Метод выделяет блок размером bytes с выравниванием alignment.
+            Блоки, которые пул не нарезает (слишком крупные или сильно выровненные), выделяются через operator new.  */
+        void* allocate(size_t bytes, size_t alignment)
+        {
+            // 1. Нестандартные запросы передаю глобальному аллокатору (блок запоминается для release()).
+            if (!isSmall(bytes, alignment)) {
+                return allocateLarge(bytes, alignment);
+            }
+
+            // 2. Если есть освобожденный блок нужного класса - переиспользую его.
+            const size_t sizeClass = classOf(bytes);
+
+            if (freeLists[sizeClass] != nullptr)
+            {
+                FreeBlock* block = freeLists[sizeClass];
+                freeLists[sizeClass] = block->next;
+                return block;
+            }
+
+            // 3. В противном случае отрезаю блок от текущего чанка (при необходимости выделяю новый).
+            const size_t blockSize = (sizeClass + 1) * granularity;
+
+            if (bumpPointer == nullptr || size_t(bumpEnd - bumpPointer) < blockSize) {
+                grow();
+            }
+
+            void* block = bumpPointer;
+            bumpPointer += blockSize;
+
+            return block;
+        }
+
+        // Метод возвращает блок в пул (параметры должны совпадать с переданными в allocate()).
+        void deallocate(void* pointer, size_t bytes, size_t alignment)
+        {
+            if (!isSmall(bytes, alignment))
+            {
+                LargeBlock* block = static_cast<LargeBlock*>(pointer) - 1;
+
+                if (block->prev != nullptr) {
+                    block->prev->next = block->next;
+                }
+                else {
+                    largeBlocks = block->next;
+                }
+
+                if (block->next != nullptr) {
+                    block->next->prev = block->prev;
+                }
+
+                reserved -= block->size;
+                freeLarge(block);
+                return;
+            }
+
+            FreeBlock* block = static_cast<FreeBlock*>(pointer);
+            const size_t sizeClass = classOf(bytes);
+
+            block->next = freeLists[sizeClass];
+            freeLists[sizeClass] = block;
+        }
+
+        /*  Метод возвращает системе все чанки и крупные блоки пула разом.
+            Важно! После вызова все выданные пулом блоки становятся недействительными.  */
+        void release()
+        {
+            while (largeBlocks != nullptr)
+            {
+                LargeBlock* next = largeBlocks->next;
+                freeLarge(largeBlocks);
+                largeBlocks = next;
+            }
+
+            while (chunks != nullptr)
+            {
+                Chunk* next = chunks->next;
+                ::operator delete(chunks);
+                chunks = next;
+            }
+
+            for (FreeBlock*& list : freeLists) {
+                list = nullptr;
+            }
+
+            bumpPointer = nullptr;
+            bumpEnd = nullptr;
+            reserved = 0;
+        }
+
+        // Метод возвращает объем памяти, которую пул сейчас держит у системы (чанки и крупные блоки).
+        size_t reservedBytes() const {
+            return reserved;
+        }
+
+        // Метод возвращает количество обращений пула к operator new за все время его жизни.
+        size_t systemAllocationCount() const {
+            return systemAllocations;
+        }
+    };
+
+    /*  PoolAllocator - аллокатор, совместимый с std::allocator, который берет память из NodePool.
+        1.  Аллокатор, созданный конструктором по умолчанию, создает собственный пул.
+        2.  Копии аллокатора разделяют один пул (два аллокатора равны, если у них общий пул).
+        3.  При копировании контейнера копия получает новый пул (см. select_on_container_copy_construction),
+        чтобы независимые списки не делили между собой непотокобезопасный пул.  */
+    template <typename T>
+    class PoolAllocator
+    {
+    private:
+        template <typename> friend class PoolAllocator;
+
+        // Пул, из которого выделяется память.
+        std::shared_ptr<NodePool> pool;
+
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
+
+        PoolAllocator() : pool(std::make_shared<NodePool>()) {}
+
+        explicit PoolAllocator(std::shared_ptr<NodePool> pool) : pool(std::move(pool)) {}
+
+        /*  Копирование объявлено явно, чтобы аллокатор не имел перемещающих операций:
+            по требованиям к аллокаторам "перемещенный" аллокатор обязан остаться равным исходному.  */
+        PoolAllocator(const PoolAllocator&) = default;
+        PoolAllocator& operator=(const PoolAllocator&) = default;
+
+        template <typename U>
+        PoolAllocator(const PoolAllocator<U>& other) noexcept : pool(other.pool) {}
+
+        T* allocate(size_t count) {
+            return static_cast<T*>(pool->allocate(count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* pointer, size_t count) {
+            pool->deallocate(pointer, count * sizeof(T), alignof(T));
+        }
+
+        PoolAllocator select_on_container_copy_construction() const {
+            return PoolAllocator();
+        }
+
+        // Метод возвращает пул, которым пользуется аллокатор.
+        const std::shared_ptr<NodePool>& getPool() const {
+            return pool;
+        }
+
+        template <typename U>
+        bool operator==(const PoolAllocator<U>& other) const {
+            return pool == other.pool;
+        }
+
+        template <typename U>
+        bool operator!=(const PoolAllocator<U>& other) const {
+            return pool != other.pool;
+        }
+    };
+
+    // isPoolAllocator - признак аллокатора PoolAllocator (его пул не допускает освобождения памяти из другого потока).
+    template <typename Allocator>
+    struct isPoolAllocator : std::false_type {};
+
+    template <typename T>
+    struct isPoolAllocator<PoolAllocator<T>> : std::true_type {};
+
+    /*  NodeReclaimer - фоновый поток, освобождающий отцепленные от контейнеров цепочки узлов.
+        1.  Контейнер в режиме отложенного освобождения не разрушает узлы сам, а передает цепочку
+        (вместе с функцией, которая умеет ее разрушить) фоновому потоку, поэтому clear() и деструктор
+        выполняются за O(1) независимо от длины списка.
+        2.  Поток создается при первом обращении и один на процесс (NodeReclaimer::instance()).
+        3.  Важно! Цепочка освобождается в другом потоке, поэтому аллокатор должен это допускать,
+        а его ресурс (например, std::pmr::memory_resource) - жить, пока цепочка не освобождена (см. drain()).  */
+    class NodeReclaimer
+    {
+    private:
+        // Task - отложенная цепочка и функция ее разрушения.
+        struct Task
+        {
+            void* chain;
+            void (*reclaim)(void*);
+        };
+
+        std::mutex mutex;
+
+        // Сигнал фоновому потоку о новых задачах (или о завершении работы).
+        std::condition_variable wake;
+
+        // Сигнал ожидающим drain() о том, что очередь опустела.
+        std::condition_variable idle;
+
+        std::vector<Task> tasks;
+
+        // Есть ли задачи, которые фоновый поток забрал, но еще не выполнил.
+        bool busy;
+
+        bool stopping;
+
+        std::thread worker;
+
+        /*  Флаг "фоновый поток уже завершен" (при завершении программы). Хранится вне объекта,
+            чтобы контейнеры со статическим временем жизни, разрушаемые позже, могли его проверить.  */
+        static inline std::atomic<bool> finished{false};
+
+        NodeReclaimer() : busy(false), stopping(false), worker(&NodeReclaimer::run, this) {}
+
+        // Метод фонового потока: забирает накопившиеся задачи пачкой и выполняет их вне блокировки.
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+
+            while (true)
+            {
+                wake.wait(lock, [this]() { return stopping || !tasks.empty(); });
+
+                if (tasks.empty()) {
+                    return;
+                }
+
+                std::vector<Task> batch;
+                batch.swap(tasks);
+                busy = true;
+                lock.unlock();
+
+                for (const Task& task : batch) {
+                    task.reclaim(task.chain);
+                }
+
+                lock.lock();
+                busy = false;
+
+                if (tasks.empty()) {
+                    idle.notify_all();
+                }
+            }
+        }
+
+    public:
+        NodeReclaimer(const NodeReclaimer&) = delete;
+        NodeReclaimer& operator=(const NodeReclaimer&) = delete;
+
+        // Деструктор дожидается освобождения всех отложенных цепочек.
+        ~NodeReclaimer()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+
+            wake.notify_one();
+            worker.join();
+            finished.store(true, std::memory_order_release);
+        }
+
+        // Метод возвращает фоновый поток процесса.
+        static NodeReclaimer& instance()
+        {
+            static NodeReclaimer reclaimer;
+            return reclaimer;
+        }
+
+        /*  Метод передает цепочку chain фоновому потоку: тот вызовет reclaim(chain).
+            Возвращает false, если передать не удалось (нехватка памяти или программа уже завершается) -
+            тогда цепочку должен освободить сам вызывающий.  */
+        static bool defer(void* chain, void (*reclaim)(void*))
+        {
+            if (finished.load(std::memory_order_acquire)) {
+                return false;
+            }
+
+            try
+            {
+                NodeReclaimer& reclaimer = instance();
+
+                {
+                    std::lock_guard<std::mutex> lock(reclaimer.mutex);
+                    reclaimer.tasks.push_back(Task{chain, reclaim});
+                }
+
+                reclaimer.wake.notify_one();
+                return true;
+            }
+            catch (...) {
+                return false;
+            }
+        }
+
+        // Метод дожидается, пока все переданные к этому моменту цепочки будут освобождены.
+        void drain()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            idle.wait(lock, [this]() { return tasks.empty() && !busy; });
+        }
+    };
+
+    /*  WorkStealingPool - пул потоков с перехватом задач (work stealing) для параллельных алгоритмов (см. parallel).
+        1.  У каждого рабочего потока своя очередь задач: свои задачи он берет с конца очереди,
+        а освободившись - забирает (перехватывает) задачи из начала чужих очередей. Поэтому поток,
+        которому достались медленные задачи, не задерживает остальных.
+        2.  Поток, вызвавший parallelFor(), тоже выполняет задачи, поэтому concurrency() равен
+        числу рабочих потоков плюс один, а пул из одного потока выполняет все задачи в вызывающем потоке.
+        3.  Очереди защищены мьютексами: задачи крупные (отрезки списка), и блокировка на задачу незаметна.  */
+    class WorkStealingPool
+    {
+    private:
+        // Batch - задачи одного вызова parallelFor() (живет в стеке вызывающего потока).
+        struct Batch
+        {
+            // Задача task(index), стертая до указателя на функцию и контекста.
+            void (*run)(void* context, size_t index);
+            void* context;
+
+            // Количество невыполненных задач.
+            std::atomic<size_t> remaining;
+
+            // Если задача выбросила исключение - остальные задачи пакета пропускаются.
+            std::atomic<bool> failed{false};
+            std::exception_ptr error;
+
+            std::mutex mutex;
+            std::condition_variable finished;
+            bool done = false;
+
+            Batch(void (*run)(void*, size_t), void* context, size_t count) : run(run), context(context), remaining(count) {}
+        };
+
+        struct Job
+        {
+            Batch* batch;
+            size_t index;
+        };
+
+        struct Queue
+        {
+            std::mutex mutex;
+            std::deque<Job> jobs;
+        };
+
+        std::vector<std::unique_ptr<Queue>> queues;
+        std::vector<std::thread> workers;
+
+        // Количество задач в очередях (по нему рабочие потоки решают, засыпать ли).
+        std::atomic<size_t> pending;
+
+        std::mutex sleepMutex;
+        std::condition_variable wake;
+        bool stopping;
+
+        // Метод забирает задачу: сначала с конца своей очереди (own), затем из начала чужих.
+        bool tryTake(size_t own, Job& job)
+        {
+            if (own < queues.size())
+            {
+                Queue& queue = *queues[own];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+
+                if (!queue.jobs.empty())
+                {
+                    job = queue.jobs.back();
+                    queue.jobs.pop_back();
+                    pending.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+
+            for (size_t i = 1; i <= queues.size(); ++i)
+            {
+                Queue& queue = *queues[(own + i) % queues.size()];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+
+                if (!queue.jobs.empty())
+                {
+                    job = queue.jobs.front();
+                    queue.jobs.pop_front();
+                    pending.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // Метод выполняет задачу и, если она последняя в пакете, будит ожидающий поток.
+        static void execute(const Job& job)
+        {
+            Batch& batch = *job.batch;
+
+            if (!batch.failed.load(std::memory_order_relaxed))
+            {
+                try {
+                    batch.run(batch.context, job.index);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(batch.mutex);
+
+                    if (!batch.failed.exchange(true)) {
+                        batch.error = std::current_exception();
+                    }
+                }
+            }
+
+            if (batch.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                // Уведомление под мьютексом: после его освобождения пакет может быть сразу разрушен.
+                std::lock_guard<std::mutex> lock(batch.mutex);
+                batch.done = true;
+                batch.finished.notify_all();
+            }
+        }
+
+        // Метод рабочего потока number.
+        void work(size_t number)
+        {
+            while (true)
+            {
+                Job job;
+
+                if (tryTake(number, job))
+                {
+                    execute(job);
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(sleepMutex);
+                wake.wait(lock, [this]() { return stopping || pending.load(std::memory_order_relaxed) > 0; });
+
+                if (stopping && pending.load(std::memory_order_relaxed) == 0) {
+                    return;
+                }
+            }
+        }
+
+    public:
+        // Конструктор запускает threadCount - 1 рабочих потоков (0 - по числу аппаратных потоков).
+        explicit WorkStealingPool(size_t threadCount = 0) : pending(0), stopping(false)
+        {
+            if (threadCount == 0) {
+                threadCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+            }
+
+            for (size_t i = 1; i < threadCount; ++i) {
+                queues.push_back(std::make_unique<Queue>());
+            }
+
+            try
+            {
+                for (size_t i = 0; i < queues.size(); ++i) {
+                    workers.emplace_back(&WorkStealingPool::work, this, i);
+                }
+            }
+            catch (...)
+            {
+                shutdown();
+                throw;
+            }
+        }
+
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        // Деструктор дожидается завершения рабочих потоков.
+        ~WorkStealingPool() {
+            shutdown();
+        }
+
+        // Метод останавливает рабочие потоки (задачи к этому моменту должны быть выполнены).
+        void shutdown()
+        {
+            {
+                std::lock_guard<std::mutex> lock(sleepMutex);
+                stopping = true;
+            }
+
+            wake.notify_all();
+
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+
+            workers.clear();
+        }
+
+        // Метод возвращает общий пул процесса (по числу аппаратных потоков).
+        static WorkStealingPool& instance()
+        {
+            static WorkStealingPool pool;
+            return pool;
+        }
+
+        // Метод возвращает количество потоков, выполняющих задачи (с учетом вызывающего).
+        size_t concurrency() const {
+            return workers.size() + 1;
+        }
+
+        /*  Метод выполняет task(0), ..., task(count - 1) на потоках пула и дожидается их завершения.
+            1.  Вызывающий поток тоже выполняет задачи, поэтому вложенные вызовы не приводят к взаимной блокировке.
+            2.  Если задача выбросила исключение, еще не начатые задачи пропускаются, а исключение
+            выбрасывается из parallelFor() после завершения уже начатых задач.  */
+        template <typename Task>
+        void parallelFor(size_t count, Task&& task)
+        {
+            using TaskType = std::remove_reference_t<Task>;
+
+            if (count == 0) {
+                return;
+            }
+
+            // 1. Без рабочих потоков (или для одной задачи) выполняю задачи сразу.
+            if (workers.empty() || count == 1)
+            {
+                for (size_t i = 0; i < count; ++i) {
+                    task(i);
+                }
+
+                return;
+            }
+
+            Batch batch([](void* context, size_t index) { (*static_cast<TaskType*>(context))(index); },
+                        const_cast<void*>(static_cast<const void*>(std::addressof(task))), count);
+
+            // 2. Раскладываю задачи по очередям рабочих потоков по кругу.
+            {
+                std::lock_guard<std::mutex> lock(sleepMutex);
+                pending.fetch_add(count, std::memory_order_relaxed);
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                Queue& queue = *queues[i % queues.size()];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                queue.jobs.push_back(Job{&batch, i});
+            }
+
+            wake.notify_all();
+
+            // 3. Помогаю выполнять задачи, пока они есть, затем дожидаюсь завершения пакета.
+            Job job;
+
+            while (batch.remaining.load(std::memory_order_acquire) > 0 && tryTake(queues.size(), job)) {
+                execute(job);
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(batch.mutex);
+                batch.finished.wait(lock, [&batch]() { return batch.done; });
+            }
+
+            if (batch.error) {
+                std::rethrow_exception(batch.error);
+            }
+        }
+    };
+
+    // ElementKind - вид элемента, записываемый в заголовок файла списка вместе с его размером.
+    enum class ElementKind : std::uint32_t
+    {
+        Unspecified = 0,    // Вид не записан (файлы, сохраненные до появления этого поля).
+        Signed = 1,         // Знаковое целое.
+        Unsigned = 2,       // Беззнаковое целое (в том числе bool).
+        Floating = 3,       // Число с плавающей точкой.
+        Other = 4           // Любой другой тип (структуры, строки, типы со своим ListSerializer).
+    };
+
+    // Функция возвращает вид элемента типа T.
+    template <typename T>
+    constexpr ElementKind elementKindOf()
+    {
+        if constexpr (std::is_floating_point_v<T>) {
+            return ElementKind::Floating;
+        }
+        else if constexpr (std::is_integral_v<T>) {
+            return std::is_signed_v<T> ? ElementKind::Signed : ElementKind::Unsigned;
+        }
+        else {
+            return ElementKind::Other;
+        }
+    }
+
+    /*  ListFileHeader - заголовок двоичного файла списка (LinkedList::saveTo()).
+        1.  За заголовком следуют count элементов: для тривиально копируемых T - сплошной массив значений
+        (elementSize == sizeof(T)), иначе - записи ListSerializer<T> (elementSize == 0).
+        2.  Тип элемента описывается парой (elementKind, elementSize): так файл LinkedList<int> не загрузится
+        в LinkedList<float>. Типы одного вида и размера (например, две структуры по 8 байт) не различаются.
+        3.  Заголовок занимает 64 байта, поэтому массив значений в отображенном в память файле выровнен.
+        4.  Числа записываются в порядке байтов платформы; byteOrder позволяет обнаружить чужой порядок.  */
+    struct ListFileHeader
+    {
+        static constexpr char expectedMagic[4] = {'D', 'L', 'S', 'T'};
+        static constexpr std::uint32_t currentVersion = 1;
+        static constexpr std::uint32_t nativeByteOrder = 0x01020304;
+
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t byteOrder;
+        std::uint32_t elementSize;
+        std::uint64_t count;
+        std::uint32_t elementKind;
+        char reserved[36];
+
+        ListFileHeader(ElementKind elementKind, std::uint32_t elementSize, std::uint64_t count)
+        : magic{expectedMagic[0], expectedMagic[1], expectedMagic[2], expectedMagic[3]}, version(currentVersion),
+          byteOrder(nativeByteOrder), elementSize(elementSize), count(count),
+          elementKind(static_cast<std::uint32_t>(elementKind)), reserved() {}
+
+        /*  Метод проверяет, что заголовок записан этой библиотекой на платформе с тем же порядком байтов
+            и описывает элементы вида expectedKind размера expectedElementSize. Иначе выбрасывает исключение.
+            У файлов без записанного вида (ElementKind::Unspecified) проверяется только размер.  */
+        void validate(ElementKind expectedKind, std::uint32_t expectedElementSize) const
+        {
+            if (std::memcmp(magic, expectedMagic, sizeof(magic)) != 0 || version != currentVersion) {
+                throw std::runtime_error("Error! The data is not a serialized list.");
+            }
+
+            if (byteOrder != nativeByteOrder) {
+                throw std::runtime_error("Error! The list was serialized on a platform with a different byte order.");
+            }
+
+            const bool kindMatches = elementKind == static_cast<std::uint32_t>(ElementKind::Unspecified)
+                                     || elementKind == static_cast<std::uint32_t>(expectedKind);
+
+            if (!kindMatches || elementSize != expectedElementSize) {
+                throw std::runtime_error("Error! The list was serialized with a different element type.");
+            }
+        }
+
+        /*  Метод проверяет, что в потоке in (если он поддерживает позиционирование) осталось не меньше
+            count записей по minRecordBytes байт. Так испорченный счетчик не приводит к выделению огромного блока.  */
+        void validateCount(std::istream& in, size_t minRecordBytes) const
+        {
+            const std::istream::pos_type position = in.tellg();
+
+            if (position == std::istream::pos_type(-1)) {
+                return;
+            }
+
+            in.seekg(0, std::ios::end);
+            const std::istream::pos_type end = in.tellg();
+            in.seekg(position);
+
+            if (!in || end < position) {
+                throw std::runtime_error("Error! The serialized list is truncated.");
+            }
+
+            const std::uint64_t remaining = static_cast<std::uint64_t>(end - position);
+
+            if (count > remaining / minRecordBytes) {
+                throw std::runtime_error("Error! The serialized list is truncated.");
+            }
+        }
+    };
+
+    static_assert(sizeof(ListFileHeader) == 64, "ListFileHeader must occupy exactly 64 bytes.");
+
+    /*  ListSerializer - двоичный формат одного элемента списка.
+        1.  Тривиально копируемые типы записываются как есть (raw == true) - списки таких элементов
+        сохраняются и загружаются сплошными блоками, а файл можно читать через MappedListView.
+        2.  Строки записываются как длина (8 байт) и символы.
+        3.  Для других типов можно определить свою специализацию с raw == false и статическими методами
+        write(std::ostream&, const T&) и read(std::istream&) (при ошибке чтения read() выбрасывает исключение).
+        4.  minRecordBytes - наименьший размер записи одного элемента: по нему до чтения проверяется, что в потоке
+        хватает данных на заявленное количество элементов (у специализации без minRecordBytes он считается равным 1).  */
+    template <typename T, typename = void>
+    struct ListSerializer;
+
+    template <typename T>
+    struct ListSerializer<T, std::enable_if_t<std::is_trivially_copyable_v<T>>>
+    {
+        static constexpr bool raw = true;
+        static constexpr size_t minRecordBytes = sizeof(T);
+    };
+
+    template <typename CharT, typename Traits, typename Allocator>
+    struct ListSerializer<std::basic_string<CharT, Traits, Allocator>>
+    {
+        using String = std::basic_string<CharT, Traits, Allocator>;
+
+        static constexpr bool raw = false;
+        static constexpr size_t minRecordBytes = sizeof(std::uint64_t);
+
+        static void write(std::ostream& out, const String& value)
+        {
+            const std::uint64_t length = value.size();
+            out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+            out.write(reinterpret_cast<const char*>(value.data()), std::streamsize(length * sizeof(CharT)));
+        }
+
+        static String read(std::istream& in)
+        {
+            std::uint64_t length = 0;
+
+            if (!in.read(reinterpret_cast<char*>(&length), sizeof(length))) {
+                throw std::runtime_error("Error! The serialized list is truncated.");
+            }
+
+            // Длина читается из файла, поэтому строка растет порциями, а не выделяется сразу целиком.
+            String value;
+            CharT buffer[1024];
+
+            while (length > 0)
+            {
+                const size_t portion = size_t(std::min<std::uint64_t>(length, sizeof(buffer) / sizeof(CharT)));
+
+                if (!in.read(reinterpret_cast<char*>(buffer), std::streamsize(portion * sizeof(CharT)))) {
+                    throw std::runtime_error("Error! The serialized list is truncated.");
+                }
+
+                value.append(buffer, portion);
+                length -= portion;
+            }
+
+            return value;
+        }
+    };
+
+    // minRecordBytesOf - наименьший размер записи элемента для сериализатора Serializer (1, если он не задан).
+    template <typename Serializer, typename = void>
+    struct minRecordBytesOf : std::integral_constant<size_t, 1> {};
+
+    template <typename Serializer>
+    struct minRecordBytesOf<Serializer, std::void_t<decltype(Serializer::minRecordBytes)>>
+    : std::integral_constant<size_t, (Serializer::minRecordBytes > 0 ? Serializer::minRecordBytes : 1)> {};
+
+    // ListOperation - операции LinkedList, по которым собирается статистика.
+    enum class ListOperation : unsigned
+    {
+        PushFront,
+        PushBack,
+        PopFront,
+        PopBack,
+        Find,       // find() и contains().
+        Remove,
+        Index,      // operator[].
+        Sort,
+        Insert,     // insertAt() и emplaceAt() (в том числе в начало и в конец списка).
+        Erase,      // eraseAt() (в том числе первого элемента).
+        Count   // Количество операций (не является операцией).
+    };
+
+    // Метод возвращает имя операции (используется в JSON-отчете).
+    inline const char* operationName(ListOperation operation)
+    {
+        static const char* const names[] = {"pushFront", "pushBack", "popFront", "popBack", "find", "remove", "index", "sort", "insert", "erase"};
+        return names[static_cast<unsigned>(operation)];
+    }
+
+    /*  NoStats - политика статистики по умолчанию: ничего не собирает.
+        Все ее методы пусты, а сама она не занимает места в списке ([[no_unique_address]]),
+        поэтому список без статистики не платит за нее ничем.  */
+    struct NoStats
+    {
+        static constexpr bool enabled = false;
+
+        struct Timer {};
+
+        Timer startTimer(ListOperation) noexcept {
+            return Timer();
+        }
+
+        void onAllocate(size_t, size_t = 1) noexcept {}
+        void onDeallocate(size_t = 1) noexcept {}
+        void onTraverse(ListOperation, size_t) noexcept {}
+        void onCompare(size_t) noexcept {}
+    };
+
+    /*  StatsCounter - счетчик статистики.
+        Увеличивает его только поток, работающий со списком, поэтому вместо атомарного сложения
+        используются обычные чтение и запись (relaxed) - это так же дешево, как инкремент обычной переменной,
+        но позволяет безопасно снимать показания из другого потока.  */
+    class StatsCounter
+    {
+    private:
+        std::atomic<std::uint64_t> value{0};
+
+    public:
+        void add(std::uint64_t amount) noexcept {
+            value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        }
+
+        // Метод поднимает значение счетчика до candidate (если оно больше текущего).
+        void raiseTo(std::uint64_t candidate) noexcept
+        {
+            if (candidate > value.load(std::memory_order_relaxed)) {
+                value.store(candidate, std::memory_order_relaxed);
+            }
+        }
+
+        std::uint64_t load() const noexcept {
+            return value.load(std::memory_order_relaxed);
+        }
+    };
+
+    /*  ListStatsSnapshot - снимок статистики списка (обычная структура, которую можно копировать,
+        сравнивать между собой и выгружать в JSON).  */
+    struct ListStatsSnapshot
+    {
+        // Количество корзин гистограммы задержек: корзина i содержит вызовы длительностью [2^i, 2^(i+1)) нс.
+        static constexpr size_t latencyBuckets = 40;
+
+        static constexpr size_t operationCount = static_cast<size_t>(ListOperation::Count);
+
+        struct OperationStats
+        {
+            // Количество вызовов.
+            std::uint64_t calls = 0;
+
+            // Суммарное количество пройденных узлов (для find, remove, operator[], insertAt, eraseAt и popBack).
+            std::uint64_t nodesTraversed = 0;
+
+            // Гистограмма задержек (заполняется только при включенном замере задержек).
+            std::uint64_t latencyCount = 0;
+            std::uint64_t latencyTotalNs = 0;
+            std::array<std::uint64_t, latencyBuckets> latency{};
+        };
+
+        std::uint64_t allocations = 0;
+        std::uint64_t deallocations = 0;
+        std::uint64_t peakSize = 0;
+        std::uint64_t sortComparisons = 0;
+
+        // Собирались ли задержки.
+        bool hasLatency = false;
+
+        std::array<OperationStats, operationCount> operations{};
+
+        const OperationStats& operator[](ListOperation operation) const {
+            return operations[static_cast<size_t>(operation)];
+        }
+
+        // Метод возвращает снимок в формате JSON (одна строка).
+        std::string toJson() const
+        {
+            std::string json = "{\"allocations\":" + std::to_string(allocations) +
+                               ",\"deallocations\":" + std::to_string(deallocations) +
+                               ",\"peak_size\":" + std::to_string(peakSize) +
+                               ",\"sort_comparisons\":" + std::to_string(sortComparisons) +
+                               ",\"operations\":{";
+
+            for (size_t i = 0; i < operationCount; ++i)
+            {
+                const OperationStats& stats = operations[i];
+
+                json += (i == 0 ? "\"" : ",\"") + std::string(operationName(static_cast<ListOperation>(i))) +
+                        "\":{\"calls\":" + std::to_string(stats.calls) +
+                        ",\"nodes_traversed\":" + std::to_string(stats.nodesTraversed);
+
+                if (hasLatency)
+                {
+                    json += ",\"latency\":{\"count\":" + std::to_string(stats.latencyCount) +
+                            ",\"total_ns\":" + std::to_string(stats.latencyTotalNs) + ",\"buckets\":[";
+
+                    for (size_t bucket = 0; bucket < latencyBuckets; ++bucket) {
+                        json += (bucket == 0 ? "" : ",") + std::to_string(stats.latency[bucket]);
+                    }
+
+                    json += "]}";
+                }
+
+                json += "}";
+            }
+
+            return json + "}}";
+        }
+    };
+
+    /*  ListStats - политика статистики, которую можно оставить включенной в продакшене.
+        1.  Считает выделения и освобождения памяти под узлы (обращения к аллокатору: отдельный узел или
+        целый блок после compact() / loadFrom() - одно обращение), пиковую длину списка, количество пройденных
+        узлов за вызов find / remove / removeIf / operator[] / insertAt / eraseAt / popBack и количество сравнений при сортировке.
+        2.  При RecordLatency = true дополнительно строит гистограммы задержек операций
+        (два чтения std::chrono::steady_clock на вызов). Место под гистограммы (~3,3 КиБ) занимается
+        только в этом режиме.
+        3.  Показания снимаются методом snapshot() (в том числе из другого потока).  */
+    template <bool RecordLatency = false>
+    class ListStats
+    {
+    private:
+        struct OperationCounters
+        {
+            StatsCounter calls;
+            StatsCounter nodesTraversed;
+        };
+
+        // LatencyCounters - гистограмма задержек одной операции.
+        struct LatencyCounters
+        {
+            StatsCounter latencyCount;
+            StatsCounter latencyTotalNs;
+            StatsCounter latency[ListStatsSnapshot::latencyBuckets];
+        };
+
+        /*  Гистограммы задержек всех операций. При RecordLatency = false вместо них пустая структура,
+            которая не занимает места ([[no_unique_address]]).  */
+        struct LatencyHistograms
+        {
+            LatencyCounters operations[ListStatsSnapshot::operationCount];
+        };
+
+        struct NoLatency {};
+
+        StatsCounter allocations;
+        StatsCounter deallocations;
+        StatsCounter peakSize;
+        StatsCounter sortComparisons;
+
+        OperationCounters operations[ListStatsSnapshot::operationCount];
+
+        [[no_unique_address]] std::conditional_t<RecordLatency, LatencyHistograms, NoLatency> latencies;
+
+        // Метод записывает задержку nanoseconds операции operation в гистограмму.
+        void recordLatency(ListOperation operation, std::uint64_t nanoseconds) noexcept
+        {
+            LatencyCounters& counters = latencies.operations[static_cast<size_t>(operation)];
+            size_t bucket = 0;
+
+            while ((nanoseconds >> (bucket + 1)) != 0 && bucket + 1 < ListStatsSnapshot::latencyBuckets) {
+                ++bucket;
+            }
+
+            counters.latency[bucket].add(1);
+            counters.latencyCount.add(1);
+            counters.latencyTotalNs.add(nanoseconds);
+        }
+
+        // LatencyTimer - замеряет время от создания до разрушения и записывает его в гистограмму.
+        class LatencyTimer
+        {
+        private:
+            ListStats& stats;
+            ListOperation operation;
+            std::chrono::steady_clock::time_point start;
+
+        public:
+            LatencyTimer(ListStats& stats, ListOperation operation)
+            : stats(stats), operation(operation), start(std::chrono::steady_clock::now()) {}
+
+            LatencyTimer(const LatencyTimer&) = delete;
+            LatencyTimer& operator=(const LatencyTimer&) = delete;
+
+            ~LatencyTimer()
+            {
+                const auto elapsed = std::chrono::steady_clock::now() - start;
+                stats.recordLatency(operation, static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+            }
+        };
+
+    public:
+        static constexpr bool enabled = true;
+
+        using Timer = std::conditional_t<RecordLatency, LatencyTimer, NoStats::Timer>;
+
+        ListStats() = default;
+        ListStats(const ListStats&) = delete;
+        ListStats& operator=(const ListStats&) = delete;
+
+        /*  Метод вызывается в начале каждой операции operation: учитывает вызов и начинает
+            замер задержки (замер заканчивается при разрушении таймера).  */
+        Timer startTimer(ListOperation operation) noexcept
+        {
+            operations[static_cast<size_t>(operation)].calls.add(1);
+
+            if constexpr (RecordLatency) {
+                return Timer(*this, operation);
+            }
+            else {
+                return Timer();
+            }
+        }
+
+        /*  Метод вызывается после того, как список вырос до sizeAfter элементов, выполнив count обращений
+            к аллокатору (отдельный узел или целый блок узлов - одно обращение, встроенный узел - ни одного).  */
+        void onAllocate(size_t sizeAfter, size_t count = 1) noexcept
+        {
+            allocations.add(count);
+            peakSize.raiseTo(sizeAfter);
+        }
+
+        // Метод вызывается после того, как список вернул аллокатору count выделений (узлов или блоков).
+        void onDeallocate(size_t count = 1) noexcept {
+            deallocations.add(count);
+        }
+
+        // Метод учитывает nodes узлов, пройденных операцией operation.
+        void onTraverse(ListOperation operation, size_t nodes) noexcept {
+            operations[static_cast<size_t>(operation)].nodesTraversed.add(nodes);
+        }
+
+        // Метод вызывается один раз за сортировку, выполнившую comparisons сравнений.
+        void onCompare(size_t comparisons) noexcept {
+            sortComparisons.add(comparisons);
+        }
+
+        // Метод возвращает снимок текущих показаний.
+        ListStatsSnapshot snapshot() const
+        {
+            ListStatsSnapshot result;
+            result.allocations = allocations.load();
+            result.deallocations = deallocations.load();
+            result.peakSize = peakSize.load();
+            result.sortComparisons = sortComparisons.load();
+            result.hasLatency = RecordLatency;
+
+            for (size_t i = 0; i < ListStatsSnapshot::operationCount; ++i)
+            {
+                const OperationCounters& counters = operations[i];
+                ListStatsSnapshot::OperationStats& stats = result.operations[i];
+
+                stats.calls = counters.calls.load();
+                stats.nodesTraversed = counters.nodesTraversed.load();
+
+                if constexpr (RecordLatency)
+                {
+                    const LatencyCounters& latency = latencies.operations[i];
+                    stats.latencyCount = latency.latencyCount.load();
+                    stats.latencyTotalNs = latency.latencyTotalNs.load();
+
+                    for (size_t bucket = 0; bucket < ListStatsSnapshot::latencyBuckets; ++bucket) {
+                        stats.latency[bucket] = latency.latency[bucket].load();
+                    }
+                }
+            }
+
+            return result;
+        }
+    };
+
+    /*  LinkedList - шаблонный класс, описывающий структуру однонаправленного связанного списка.
+        Allocator - аллокатор узлов (std::allocator, PoolAllocator, std::pmr::polymorphic_allocator и т.п.).
+        Stats - политика статистики (NoStats - без статистики, ListStats<> - счетчики, ListStats<true> - еще и задержки).
+        N - количество узлов, хранящихся прямо в объекте списка (0 - все узлы выделяются аллокатором).
+        Первые N узлов не требуют выделения памяти; при перемещении такого списка значения встроенных
+        узлов переносятся в новый объект, поэтому итераторы на них становятся недействительными
+        (итераторы на остальные узлы остаются действительными, как и при N == 0).  */
+    template <typename T, typename Allocator = std::allocator<T>, typename Stats = NoStats, size_t N = 0>
+    class LinkedList
+    {
+    private:
+        static_assert(N <= 64, "LinkedList supports at most 64 inline nodes.");
+        static_assert(N == 0 || std::is_nothrow_move_constructible_v<T>,
+                      "Inline nodes require a type that can be moved without exceptions.");
+
+        // ListNode - cтруктура узла.
+        template <typename Type>
+        struct ListNode
+        {
+            // Значение, хранящееся в узле.
+            Type value;
+
+            // Указатель на следующий узел списка.
+            ListNode<Type>* next;
+
+            // Значение конструируется по месту из аргументов args.
+            template <typename... Args>
+            ListNode(std::in_place_t, Args&&... args) : value(std::forward<Args>(args)...), next(nullptr) {}
+        };
+
+        // Размер списка на текущий момент.
+        size_t sizeOfList;
+
+        // Указатель на первый узел списка.
+        ListNode<T>* head;
+
+        // Указатель на последний узел списка.
+        ListNode<T>* tail;
+
+        /*  Курсор последнего обращения по индексу: узел cursorNode имеет индекс cursorIndex.
+            Позволяет последовательному (и близкому) доступу по индексу продолжать обход с места
+            предыдущего обращения, а не с головы списка. Если курсор не установлен - cursorNode == nullptr.  */
+        ListNode<T>* cursorNode;
+        size_t cursorIndex;
+
+        // Аллокатор узлов (аллокатор Allocator, перепривязанный к типу ListNode<T>).
+        using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<ListNode<T>>;
+        using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+        [[no_unique_address]] NodeAllocator allocator;
+
+        // Статистика (изменяется и в константных методах, например в find()).
+        [[no_unique_address]] mutable Stats stats;
+
+        /*  CompactBlock - непрерывный блок узлов, созданный методом compact().
+            Узлы блока не возвращаются аллокатору по одному: блок освобождается целиком, когда в нем
+            не остается живых узлов и на него не ссылается ни один список. Счетчики атомарные,
+            так как узлы одного блока могут принадлежать разным спискам.  */
+        struct CompactBlock
+        {
+            // Массив узлов блока и его длина.
+            ListNode<T>* nodes;
+            size_t capacity;
+
+            // Количество живых узлов блока.
+            std::atomic<size_t> live;
+
+            // Количество списков, ссылающихся на блок.
+            std::atomic<size_t> refs;
+
+            CompactBlock(ListNode<T>* nodes, size_t capacity) : nodes(nodes), capacity(capacity), live(capacity), refs(1) {}
+        };
+
+        using BlockAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<CompactBlock>;
+        using BlockTraits = std::allocator_traits<BlockAllocator>;
+
+        /*  AuxiliaryState - редко используемое состояние списка: компактизация и отложенное освобождение.
+            Оно нужно только спискам, которые вызывали compact(), loadFrom(), setAutoCompact() или
+            setDeferredReclamation() (либо приняли узлы из блоков другого списка), поэтому создается
+            при первом обращении: остальные списки платят за него одним указателем.  */
+        struct AuxiliaryState
+        {
+            /*  Блоки, в которых могут находиться узлы списка (обычно не больше одного).
+                Упорядочены по адресу узлов, чтобы блок узла находился двоичным поиском (см. blockOf()).  */
+            std::vector<CompactBlock*> blocks;
+
+            // Количество узлов, освобожденных с момента последней компактизации (мера фрагментации).
+            size_t freedSinceCompact = 0;
+
+            /*  Параметры автоматической компактизации: она выполняется, когда освобождено не меньше
+                autoCompactRatio * size() узлов, а длина списка не меньше autoCompactMinLength (0 - выключена).  */
+            double autoCompactRatio = 0;
+            size_t autoCompactMinLength = 0;
+
+            // Режим отложенного освобождения узлов (см. setDeferredReclamation()).
+            bool deferredReclamation = false;
+        };
+
+        std::unique_ptr<AuxiliaryState> auxiliary;
+
+        /*  InlineNodes - встроенное хранилище на Capacity узлов внутри объекта списка.
+            Бит i маски free установлен, если ячейка i свободна.  */
+        template <size_t Capacity, typename = void>
+        struct InlineNodes
+        {
+            static constexpr std::uint64_t allFree = Capacity == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << Capacity) - 1;
+
+            alignas(ListNode<T>) unsigned char slots[Capacity * sizeof(ListNode<T>)];
+            std::uint64_t free = allFree;
+
+            ListNode<T>* node(size_t slot) noexcept {
+                return reinterpret_cast<ListNode<T>*>(slots) + slot;
+            }
+
+            // Метод возвращает номер ячейки узла node (или Capacity, если узел лежит вне хранилища).
+            size_t slotOf(const ListNode<T>* node) const noexcept
+            {
+                const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(node);
+                const std::uintptr_t first = reinterpret_cast<std::uintptr_t>(slots);
+
+                if (address < first || address >= first + sizeof(slots)) {
+                    return Capacity;
+                }
+
+                return (address - first) / sizeof(ListNode<T>);
+            }
+        };
+
+        // При N == 0 хранилище пусто и ([[no_unique_address]]) не занимает места в списке.
+        template <typename Unused>
+        struct InlineNodes<0, Unused> {};
+
+        [[no_unique_address]] InlineNodes<N> inlineNodes;
+
+        // Метод возвращает номер младшего установленного бита маски mask (mask != 0).
+        static size_t lowestBit(std::uint64_t mask) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(__builtin_ctzll(mask));
+#else
+            size_t bit = 0;
+
+            for (; (mask & 1) == 0; mask >>= 1) {
+                ++bit;
+            }
+
+            return bit;
+#endif
+        }
+
+        // Метод занимает свободную ячейку встроенного хранилища (nullptr - свободных ячеек нет).
+        ListNode<T>* takeInlineSlot() noexcept
+        {
+            if constexpr (N > 0)
+            {
+                if (inlineNodes.free != 0)
+                {
+                    const size_t slot = lowestBit(inlineNodes.free);
+                    inlineNodes.free &= inlineNodes.free - 1;
+                    return inlineNodes.node(slot);
+                }
+            }
+
+            return nullptr;
+        }
+
+        // Метод освобождает ячейку встроенного хранилища, если узел node лежит в нем (возвращает false, если нет).
+        bool releaseInlineSlot(const ListNode<T>* node) noexcept
+        {
+            if constexpr (N > 0)
+            {
+                const size_t slot = inlineNodes.slotOf(node);
+
+                if (slot < N)
+                {
+                    inlineNodes.free |= std::uint64_t(1) << slot;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /*  Метод переносит значения встроенных узлов other в те же ячейки нашего хранилища
+            (после того, как наш список забрал цепочку узлов other). Все наши ячейки должны быть свободны.  */
+        void relocateInlineNodes(LinkedList& other) noexcept
+        {
+            if constexpr (N > 0)
+            {
+                for (ListNode<T>** link = &head; other.inlineNodes.free != InlineNodes<N>::allFree; link = &(*link)->next)
+                {
+                    ListNode<T>* node = *link;
+                    const size_t slot = other.inlineNodes.slotOf(node);
+
+                    if (slot == N) {
+                        continue;
+                    }
+
+                    ListNode<T>* target = inlineNodes.node(slot);
+                    NodeTraits::construct(allocator, target, std::in_place, std::move(node->value));
+                    target->next = node->next;
+                    NodeTraits::destroy(allocator, node);
+
+                    *link = target;
+
+                    if (tail == node) {
+                        tail = target;
+                    }
+
+                    inlineNodes.free &= ~(std::uint64_t(1) << slot);
+                    other.inlineNodes.free |= std::uint64_t(1) << slot;
+                }
+            }
+        }
+
+        /*  Метод переносит в узлы аллокатора значения встроенных узлов, лежащих строго между узлами before
+            и last (before == nullptr - с головы списка). Вызывается перед передачей узлов другому списку:
+            встроенный узел нельзя вынести за пределы объекта. При исключении список остается корректным.  */
+        void spillInlineNodes(ListNode<T>* before, ListNode<T>* last)
+        {
+            if constexpr (N > 0)
+            {
+                ListNode<T>** link = before == nullptr ? &head : &before->next;
+
+                for (; *link != last && inlineNodes.free != InlineNodes<N>::allFree; link = &(*link)->next)
+                {
+                    ListNode<T>* node = *link;
+
+                    if (inlineNodes.slotOf(node) == N) {
+                        continue;
+                    }
+
+                    ListNode<T>* heapNode = NodeTraits::allocate(allocator, 1);
+                    NodeTraits::construct(allocator, heapNode, std::in_place, std::move(node->value));
+                    heapNode->next = node->next;
+                    NodeTraits::destroy(allocator, node);
+                    releaseInlineSlot(node);
+                    stats.onAllocate(sizeOfList);
+
+                    *link = heapNode;
+
+                    if (tail == node) {
+                        tail = heapNode;
+                    }
+
+                    if (cursorNode == node) {
+                        cursorNode = heapNode;
+                    }
+                }
+            }
+        }
+
+        /*  Метод конструирует узел из аргументов args: в свободной ячейке встроенного хранилища,
+            а если ее нет - в памяти, выделенной аллокатором.  */
+        template <typename... Args>
+        ListNode<T>* createNode(Args&&... args)
+        {
+            ListNode<T>* node = takeInlineSlot();
+            const bool allocated = node == nullptr;
+
+            if (allocated) {
+                node = NodeTraits::allocate(allocator, 1);
+            }
+
+            // Если конструктор значения выбросит исключение - память необходимо вернуть.
+            try {
+                NodeTraits::construct(allocator, node, std::in_place, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                if (!releaseInlineSlot(node)) {
+                    NodeTraits::deallocate(allocator, node, 1);
+                }
+
+                throw;
+            }
+
+            stats.onAllocate(sizeOfList + 1, allocated ? 1 : 0);
+
+            return node;
+        }
+
+        // Метод разрушает узел и возвращает его память аллокатору.
+        void destroyNode(ListNode<T>* node)
+        {
+            NodeTraits::destroy(allocator, node);
+            releaseNodeMemory(node);
+        }
+
+        // Метод возвращает состояние компактизации, создавая его при первом обращении.
+        AuxiliaryState& auxiliaryState()
+        {
+            if (auxiliary == nullptr) {
+                auxiliary = std::make_unique<AuxiliaryState>();
+            }
+
+            return *auxiliary;
+        }
+
+        // Метод переносит в список настройки other (автоматическая компактизация, отложенное освобождение), не трогая блоки.
+        void copySettings(const LinkedList& other)
+        {
+            if (other.auxiliary == nullptr && auxiliary == nullptr) {
+                return;
+            }
+
+            const AuxiliaryState defaults;
+            const AuxiliaryState& source = other.auxiliary != nullptr ? *other.auxiliary : defaults;
+            AuxiliaryState& state = auxiliaryState();
+
+            state.autoCompactRatio = source.autoCompactRatio;
+            state.autoCompactMinLength = source.autoCompactMinLength;
+            state.deferredReclamation = source.deferredReclamation;
+        }
+
+        // Метод показывает, ссылается ли список хотя бы на один блок.
+        bool hasBlocks() const {
+            return auxiliary != nullptr && !auxiliary->blocks.empty();
+        }
+
+        // Метод возвращает позицию первого блока из blocks, узлы которого начинаются не раньше адреса address.
+        static size_t blockPosition(const std::vector<CompactBlock*>& blocks, std::uintptr_t address)
+        {
+            auto position = std::lower_bound(blocks.begin(), blocks.end(), address,
+                [](const CompactBlock* block, std::uintptr_t value) { return reinterpret_cast<std::uintptr_t>(block->nodes) < value; });
+
+            return static_cast<size_t>(position - blocks.begin());
+        }
+
+        // Метод вставляет блок в blocks, сохраняя порядок по адресу (место в blocks должно быть зарезервировано).
+        static void insertBlock(std::vector<CompactBlock*>& blocks, CompactBlock* block) noexcept {
+            blocks.insert(blocks.begin() + blockPosition(blocks, reinterpret_cast<std::uintptr_t>(block->nodes)), block);
+        }
+
+        // Метод возвращает блок, которому принадлежит узел node (nullptr - узел выделен отдельно), за O(log блоков).
+        CompactBlock* blockOf(const ListNode<T>* node) const
+        {
+            if (auxiliary == nullptr) {
+                return nullptr;
+            }
+
+            const std::vector<CompactBlock*>& blocks = auxiliary->blocks;
+            const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(node);
+
+            // Узел может лежать только в последнем блоке, начинающемся не позже него.
+            size_t position = blockPosition(blocks, address);
+
+            if (position < blocks.size() && reinterpret_cast<std::uintptr_t>(blocks[position]->nodes) == address) {
+                return blocks[position];
+            }
+
+            if (position == 0) {
+                return nullptr;
+            }
+
+            CompactBlock* block = blocks[position - 1];
+            const std::uintptr_t first = reinterpret_cast<std::uintptr_t>(block->nodes);
+
+            return address < first + block->capacity * sizeof(ListNode<T>) ? block : nullptr;
+        }
+
+        // Метод снимает ссылку списка с блока и освобождает блок, если ссылок на него не осталось.
+        void releaseBlock(CompactBlock* block)
+        {
+            std::vector<CompactBlock*>& blocks = auxiliary->blocks;
+            blocks.erase(blocks.begin() + blockPosition(blocks, reinterpret_cast<std::uintptr_t>(block->nodes)));
+
+            if (block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                BlockAllocator blockAllocator(allocator);
+
+                NodeTraits::deallocate(allocator, block->nodes, block->capacity);
+                BlockTraits::destroy(blockAllocator, block);
+                BlockTraits::deallocate(blockAllocator, block, 1);
+                stats.onDeallocate();
+            }
+        }
+
+        /*  Метод возвращает память уже разрушенного узла: встроенный узел - хранилищу,
+            отдельный узел - аллокатору, узел блока - блоку.  */
+        void releaseNodeMemory(ListNode<T>* node)
+        {
+            if (releaseInlineSlot(node)) {
+                return;
+            }
+
+            if (auxiliary != nullptr) {
+                ++auxiliary->freedSinceCompact;
+            }
+
+            if (hasBlocks())
+            {
+                if (CompactBlock* block = blockOf(node))
+                {
+                    if (block->live.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                        releaseBlock(block);
+                    }
+
+                    return;
+                }
+            }
+
+            NodeTraits::deallocate(allocator, node, 1);
+            stats.onDeallocate();
+        }
+
+        /*  Метод выделяет блок из count узлов (значения в узлах еще не сконструированы).
+            Место под ссылку на блок в blocks резервируется заранее, чтобы linkBlock() не мог выбросить исключение.  */
+        CompactBlock* allocateBlock(size_t count)
+        {
+            std::vector<CompactBlock*>& blocks = auxiliaryState().blocks;
+            blocks.reserve(blocks.size() + 1);
+
+            BlockAllocator blockAllocator(allocator);
+            CompactBlock* block = BlockTraits::allocate(blockAllocator, 1);
+            ListNode<T>* nodes = nullptr;
+
+            try {
+                nodes = NodeTraits::allocate(allocator, count);
+            }
+            catch (...)
+            {
+                BlockTraits::deallocate(blockAllocator, block, 1);
+                throw;
+            }
+
+            BlockTraits::construct(blockAllocator, block, nodes, count);
+            return block;
+        }
+
+        // Метод разрушает первые built узлов еще не подключенного блока и освобождает блок (при ошибке заполнения).
+        void discardBlock(CompactBlock* block, size_t built)
+        {
+            BlockAllocator blockAllocator(allocator);
+
+            while (built > 0) {
+                NodeTraits::destroy(allocator, block->nodes + --built);
+            }
+
+            NodeTraits::deallocate(allocator, block->nodes, block->capacity);
+            BlockTraits::destroy(blockAllocator, block);
+            BlockTraits::deallocate(blockAllocator, block, 1);
+        }
+
+        /*  Метод делает заполненный блок цепочкой узлов списка: узлы связываются по порядку.
+            Прежние узлы списка к этому моменту должны быть освобождены.  */
+        void linkBlock(CompactBlock* block)
+        {
+            ListNode<T>* nodes = block->nodes;
+            insertBlock(auxiliary->blocks, block);
+
+            for (size_t i = 0; i + 1 < block->capacity; ++i) {
+                nodes[i].next = nodes + i + 1;
+            }
+
+            nodes[block->capacity - 1].next = nullptr;
+
+            head = nodes;
+            tail = nodes + block->capacity - 1;
+            sizeOfList = block->capacity;
+        }
+
+        /*  Метод выполняет компактизацию, если список достаточно фрагментирован (см. setAutoCompact()).
+            Компактизация - лишь оптимизация, поэтому ее неудача (например, нехватка памяти) игнорируется:
+            в этом случае список остается прежним.  */
+        void compactIfFragmented()
+        {
+            if (auxiliary != nullptr && auxiliary->autoCompactRatio > 0 && sizeOfList >= auxiliary->autoCompactMinLength &&
+                static_cast<double>(auxiliary->freedSinceCompact) >= auxiliary->autoCompactRatio * static_cast<double>(sizeOfList))
+            {
+                try {
+                    compact();
+                }
+                catch (...) {
+                    auxiliary->freedSinceCompact = 0;
+                }
+            }
+        }
+
+        // Метод показывает, принадлежит ли пул узлов только этому списку (тогда его можно сбросить целиком).
+        bool ownsArena() const
+        {
+            if constexpr (isPoolAllocator<NodeAllocator>::value) {
+                return !hasBlocks() && allocator.getPool().use_count() == 1;
+            }
+            else {
+                return false;
+            }
+        }
+
+        /*  Метод возвращает количество выделений памяти, которые будут возвращены аллокатору при освобождении
+            всех узлов списка: отдельные узлы и блоки, на которые больше не ссылаются другие списки (для статистики).
+            Обычно это O(число блоков); узлы обходятся, только если какой-то блок разделен с другим списком.  */
+        size_t ownedAllocations() const
+        {
+            size_t inBlocks = 0;
+            size_t ownedBlocks = 0;
+            bool shared = false;
+
+            if (auxiliary != nullptr)
+            {
+                for (CompactBlock* block : auxiliary->blocks)
+                {
+                    if (block->refs.load(std::memory_order_acquire) == 1)
+                    {
+                        inBlocks += block->live.load(std::memory_order_acquire);
+                        ++ownedBlocks;
+                    }
+                    else {
+                        shared = true;
+                    }
+                }
+            }
+
+            size_t inlineUsed = 0;
+
+            if constexpr (N > 0)
+            {
+                for (std::uint64_t used = ~inlineNodes.free & InlineNodes<N>::allFree; used != 0; used &= used - 1) {
+                    ++inlineUsed;
+                }
+            }
+
+            if (!shared) {
+                return sizeOfList - inlineUsed - inBlocks + ownedBlocks;
+            }
+
+            size_t separate = 0;
+
+            for (ListNode<T>* current = head; current != nullptr; current = current->next)
+            {
+                if constexpr (N > 0)
+                {
+                    if (inlineNodes.slotOf(current) != N) {
+                        continue;
+                    }
+                }
+
+                if (blockOf(current) == nullptr) {
+                    ++separate;
+                }
+            }
+
+            return separate + ownedBlocks;
+        }
+
+        /*  Метод освобождает все узлы списка сбросом пула (ownsArena() == true): деструкторы значений
+            вызываются только для нетривиально разрушаемых T, а память возвращается системе чанками, а не по узлу.  */
+        void resetArena()
+        {
+            if constexpr (isPoolAllocator<NodeAllocator>::value)
+            {
+                if constexpr (!std::is_trivially_destructible_v<T>)
+                {
+                    for (ListNode<T>* current = head; current != nullptr; current = current->next) {
+                        NodeTraits::destroy(allocator, current);
+                    }
+                }
+
+                stats.onDeallocate(ownedAllocations());
+                allocator.getPool()->release();
+
+                if constexpr (N > 0) {
+                    inlineNodes.free = InlineNodes<N>::allFree;
+                }
+
+                head = nullptr;
+                tail = nullptr;
+                sizeOfList = 0;
+                resetCursor();
+
+                if (auxiliary != nullptr) {
+                    auxiliary->freedSinceCompact = 0;
+                }
+            }
+        }
+
+        // Метод разрушает все узлы списка одним проходом и снимает ссылки с блоков.
+        void destroyChain()
+        {
+            ListNode<T>* current = head;
+
+            while (current != nullptr)
+            {
+                ListNode<T>* next = current->next;
+
+                if (next != nullptr) {
+                    CONTAINERS_PREFETCH(next->next);
+                }
+
+                destroyNode(current);
+                current = next;
+            }
+
+            head = nullptr;
+            tail = nullptr;
+            sizeOfList = 0;
+            resetCursor();
+
+            // Узлов не осталось - снимаю ссылки с блоков, живые узлы которых принадлежат другим спискам.
+            while (hasBlocks()) {
+                releaseBlock(auxiliary->blocks.back());
+            }
+        }
+
+        /*  Функция разрушения цепочки, переданной в NodeReclaimer (цепочкой владеет отдельный объект списка).
+            Собственный пул такого списка сбрасывается целиком, иначе узлы освобождаются по одному.  */
+        static void reclaimOrphan(void* pointer)
+        {
+            LinkedList* orphan = static_cast<LinkedList*>(pointer);
+
+            if (orphan->ownsArena()) {
+                orphan->resetArena();
+            }
+
+            delete orphan;
+        }
+
+        /*  Метод передает все узлы списка фоновому потоку NodeReclaimer за O(1): они переносятся в отдельный
+            объект списка, который поток разрушит. Возвращает false, если передать узлы не удалось.
+            Пул PoolAllocator не допускает работы из двух потоков, поэтому узлы из пула передаются, только если
+            пул принадлежит одному этому списку: поток получает пул целиком, а список переходит на новый пул.  */
+        bool deferToReclaimer()
+        {
+            std::shared_ptr<NodePool> freshPool;
+
+            if constexpr (isPoolAllocator<NodeAllocator>::value)
+            {
+                if (!ownsArena()) {
+                    return false;
+                }
+
+                try {
+                    freshPool = std::make_shared<NodePool>();
+                }
+                catch (const std::bad_alloc&) {
+                    return false;
+                }
+            }
+
+            // Выделения, которые вернет фоновый поток, учитываются в статистике этого списка сразу.
+            const size_t count = Stats::enabled ? ownedAllocations() : 0;
+
+            /*  Блоки уходят вместе с узлами, а настройки остаются у списка:
+                если блоки есть, для настроек заранее создается новое состояние.  */
+            std::unique_ptr<AuxiliaryState> settings;
+
+            if (hasBlocks())
+            {
+                settings.reset(new (std::nothrow) AuxiliaryState());
+
+                if (settings == nullptr) {
+                    return false;
+                }
+
+                settings->autoCompactRatio = auxiliary->autoCompactRatio;
+                settings->autoCompactMinLength = auxiliary->autoCompactMinLength;
+                settings->deferredReclamation = auxiliary->deferredReclamation;
+            }
+            else {
+                settings = std::move(auxiliary);
+            }
+
+            LinkedList* orphan = new (std::nothrow) LinkedList(std::move(*this));
+
+            if (orphan == nullptr)
+            {
+                if (auxiliary == nullptr) {
+                    auxiliary = std::move(settings);
+                }
+
+                return false;
+            }
+
+            auxiliary = std::move(settings);
+
+            if (orphan->auxiliary != nullptr) {
+                orphan->auxiliary->deferredReclamation = false;
+            }
+
+            if (NodeReclaimer::defer(orphan, &reclaimOrphan))
+            {
+                if constexpr (isPoolAllocator<NodeAllocator>::value) {
+                    allocator = NodeAllocator(std::move(freshPool));
+                }
+            }
+            else {
+                reclaimOrphan(orphan);
+            }
+
+            stats.onDeallocate(count);
+            return true;
+        }
+
+        // Метод сбрасывает курсор последнего обращения по индексу (вызывается после перестройки списка).
+        void resetCursor()
+        {
+            cursorNode = nullptr;
+            cursorIndex = 0;
+        }
+
+        /*  Метод возвращает узел с индексом position (position < sizeOfList).
+            1.  Обход начинается с курсора, если он стоит не дальше искомого узла, иначе - с головы.
+            2.  Последний узел возвращается сразу через хвост.
+            3.  Курсор переставляется на найденный узел.
+            Пройденные узлы учитываются в статистике операции operation.  */
+        ListNode<T>* nodeAt(size_t position, ListOperation operation = ListOperation::Index)
+        {
+            ListNode<T>* tempPtr = head;
+            size_t index = 0;
+
+            if (position == sizeOfList - 1)
+            {
+                tempPtr = tail;
+                index = position;
+            }
+            else if (cursorNode != nullptr && cursorIndex <= position)
+            {
+                tempPtr = cursorNode;
+                index = cursorIndex;
+            }
+
+            stats.onTraverse(operation, position - index);
+
+            for (; index < position; ++index) {
+                tempPtr = tempPtr->next;
+            }
+
+            cursorNode = tempPtr;
+            cursorIndex = position;
+
+            return tempPtr;
+        }
+
+        /*  Метод сливает две отсортированные цепочки узлов first и second в одну и возвращает ее голову.
+            Хвост получившейся цепочки записывается в mergedTail.
+            При равенстве элементов первым идет элемент из first (это обеспечивает устойчивость).  */
+        template <typename Compare>
+        static ListNode<T>* mergeChains(ListNode<T>* first, ListNode<T>* second, ListNode<T>*& mergedTail, Compare& compare)
+        {
+            ListNode<T>* mergedHead = nullptr;
+            ListNode<T>** link = &mergedHead;
+
+            // 1. Пока обе цепочки не пусты - подвешиваю к результату меньший из первых узлов.
+            while (first != nullptr && second != nullptr)
+            {
+                if (compare(second->value, first->value))
+                {
+                    *link = second;
+                    second = second->next;
+                }
+                else
+                {
+                    *link = first;
+                    first = first->next;
+                }
+
+                mergedTail = *link;
+                link = &(*link)->next;
+            }
+
+            // 2. Остаток непустой цепочки подвешиваю целиком, а хвост ищу в нем.
+            *link = first != nullptr ? first : second;
+
+            while (mergedTail->next != nullptr) {
+                mergedTail = mergedTail->next;
+            }
+
+            return mergedHead;
+        }
+
+        /*  Метод сортирует цепочку узлов, начинающуюся с chainHead, и возвращает ее новую голову.
+            Новый хвост записывается в chainTail.
+
+            Используется восходящая сортировка слиянием: buckets[i] хранит отсортированную
+            цепочку длины 2^i, и каждый следующий узел "переносится" по ним, как единица при двоичном сложении.  */
+        template <typename Compare>
+        static ListNode<T>* sortChain(ListNode<T>* chainHead, ListNode<T>*& chainTail, Compare& compare)
+        {
+            ListNode<T>* buckets[64] = {};
+            ListNode<T>* bucketTail = nullptr;
+            size_t usedBuckets = 0;
+
+            // 1. Раскладываю узлы по корзинам.
+            while (chainHead != nullptr)
+            {
+                ListNode<T>* carry = chainHead;
+                chainHead = chainHead->next;
+                carry->next = nullptr;
+
+                size_t i = 0;
+
+                // Более ранние узлы всегда лежат в корзинах, поэтому корзина передается первой.
+                for (; buckets[i] != nullptr; ++i)
+                {
+                    carry = mergeChains(buckets[i], carry, bucketTail, compare);
+                    buckets[i] = nullptr;
+                }
+
+                buckets[i] = carry;
+                usedBuckets = std::max(usedBuckets, i + 1);
+            }
+
+            // 2. Сливаю корзины: корзины с большим номером содержат более ранние узлы.
+            ListNode<T>* result = nullptr;
+
+            for (size_t i = 0; i < usedBuckets; ++i)
+            {
+                if (buckets[i] != nullptr) {
+                    result = result == nullptr ? buckets[i] : mergeChains(buckets[i], result, bucketTail, compare);
+                }
+            }
+
+            // 3. Нахожу хвост отсортированной цепочки.
+            chainTail = result;
+
+            while (chainTail->next != nullptr) {
+                chainTail = chainTail->next;
+            }
+
+            return result;
+        }
+
+        /*  Метод добавляет элементы диапазона [first, last) в конец списка за один проход
+            (без проверок автоматической компактизации на каждом элементе).
+            Если конструктор элемента выбросит исключение, уже добавленные элементы остаются в списке.  */
+        template <typename InputIterator>
+        void appendRange(InputIterator first, InputIterator last)
+        {
+            for (; first != last; ++first)
+            {
+                ListNode<T>* newNode = createNode(*first);
+
+                if (tail != nullptr) {
+                    tail->next = newNode;
+                }
+                else {
+                    head = newNode;
+                }
+
+                tail = newNode;
+                ++sizeOfList;
+            }
+        }
+
+        /*  Метод показывает, можно ли перенести узлы other в наш список без копирования значений
+            (узлы должны освобождаться нашим аллокатором).  */
+        bool canAdoptNodes(const LinkedList& other) const {
+            return NodeTraits::is_always_equal::value || allocator == other.allocator;
+        }
+
+        /*  Метод добавляет в список ссылки на блоки other: переносимые узлы могут лежать в этих блоках,
+            и блок не должен освобождаться, пока на него ссылается хотя бы один из списков.
+            Место в blocks резервируется сразу, поэтому исключение возможно только до переноса узлов.  */
+        void adoptBlocks(const LinkedList& other)
+        {
+            if (!other.hasBlocks() || &other == this) {
+                return;
+            }
+
+            std::vector<CompactBlock*>& blocks = auxiliaryState().blocks;
+            blocks.reserve(blocks.size() + other.auxiliary->blocks.size());
+
+            for (CompactBlock* block : other.auxiliary->blocks)
+            {
+                const size_t position = blockPosition(blocks, reinterpret_cast<std::uintptr_t>(block->nodes));
+
+                if (position == blocks.size() || blocks[position] != block)
+                {
+                    block->refs.fetch_add(1, std::memory_order_relaxed);
+                    blocks.insert(blocks.begin() + position, block);
+                }
+            }
+        }
+
+        // Метод подвешивает цепочку из count узлов [chainHead, chainTail] после узла position нашего списка.
+        void linkAfter(ListNode<T>* position, ListNode<T>* chainHead, ListNode<T>* chainTail, size_t count)
+        {
+            chainTail->next = position->next;
+            position->next = chainHead;
+
+            if (tail == position) {
+                tail = chainTail;
+            }
+
+            sizeOfList += count;
+            resetCursor();
+        }
+
+        // Метод делает список пустым после того, как все его узлы перенесены в другой список.
+        void releaseTransferredNodes()
+        {
+            sizeOfList = 0;
+            head = nullptr;
+            tail = nullptr;
+            resetCursor();
+
+            while (hasBlocks()) {
+                releaseBlock(auxiliary->blocks.back());
+            }
+        }
+
+    public:
+        using allocator_type = Allocator;
+
+        /*  BasicIterator - класс, описывающий структуру итератора
+            (объекта, с помощью которого можно итерироваться по списку).
+            1.  Iterator (IsConst == false) дает доступ к элементам на запись, ConstIterator - только на чтение.
+            Iterator неявно преобразуется в ConstIterator, и итераторы обоих видов можно сравнивать между собой.
+            2.  Итератор удовлетворяет требованиям однонаправленного итератора (в том числе концепции
+            std::forward_iterator из C++20), поэтому список можно передавать в std::ranges и в views.  */
+        template <bool IsConst>
+        class BasicIterator
+        {
+        private:
+            friend class LinkedList;
+
+            template <bool> friend class BasicIterator;
+
+            // Указатель на узел, на который смотрит итератор.
+            ListNode<T>* pointerToNode;
+
+        public:
+            // Информация об итераторе для библиотеки <algorithm>:
+            using iterator_category = std::forward_iterator_tag;                 // Тип итератора.
+            using value_type = T;                                                // Тип элемента.
+            using difference_type = std::ptrdiff_t;                              // Разница между итераторами.
+            using pointer = std::conditional_t<IsConst, const T*, T*>;           // Указатель на элемент.
+            using reference = std::conditional_t<IsConst, const T&, T&>;         // Ссылка на элемент.
+
+            BasicIterator() : pointerToNode(nullptr) {}
+
+            BasicIterator(ListNode<T>* somePointer) : pointerToNode(somePointer) {}
+
+            // Преобразование Iterator -> ConstIterator.
+            template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+            BasicIterator(const BasicIterator<OtherConst>& other) : pointerToNode(other.pointerToNode) {}
+
+            // Оператор разыменования - возвращает значение узла (на который смотрит итератор) по ссылке.
+            reference operator*() const {
+                return pointerToNode->value;
+            }
+
+            // Оператор доступа к членам значения узла.
+            pointer operator->() const {
+                return std::addressof(pointerToNode->value);
+            }
+
+            /*  Оператор префиксного инкремента - передвигает итератор на следующий узел списка
+                (и заранее подгружает в кэш узел, следующий за ним).  */
+            BasicIterator& operator++()
+            {
+                pointerToNode = pointerToNode->next;
+
+                if (pointerToNode != nullptr) {
+                    CONTAINERS_PREFETCH(pointerToNode->next);
+                }
+
+                return *this;
+            }
+
+            // Оператор постфиксного инкремента - передвигает итератор и возвращает его прежнее значение.
+            BasicIterator operator++(int)
+            {
+                BasicIterator previous = *this;
+                ++*this;
+                return previous;
+            }
+
+            // Операторы сравнения - проверяют итераторы на равенство.
+            template <bool OtherConst>
+            bool operator==(const BasicIterator<OtherConst>& other) const {
+                return pointerToNode == other.pointerToNode;
+            }
+
+            template <bool OtherConst>
+            bool operator!=(const BasicIterator<OtherConst>& other) const {
+                return pointerToNode != other.pointerToNode;
+            }
+        };
+
+        using Iterator = BasicIterator<false>;
+        using ConstIterator = BasicIterator<true>;
+
+        // Имена типов, которые ожидают стандартные алгоритмы и std::ranges.
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = Iterator;
+        using const_iterator = ConstIterator;
+
+        // Метод возвращает итератор, который смотрит на голову списка.
+        Iterator begin() {
+            return Iterator(head);
+        }
+
+        ConstIterator begin() const {
+            return ConstIterator(head);
+        }
+
+        /*  Метод возвращает итератор, который смотрит на узел, 
+            следующий за хвостом (это всегда nullptr).  */
+        Iterator end() {
+            return Iterator(nullptr);
+        }
+
+        ConstIterator end() const {
+            return ConstIterator(nullptr);
+        }
+
+        // Методы возвращают итераторы только для чтения (даже для неконстантного списка).
+        ConstIterator cbegin() const {
+            return ConstIterator(head);
+        }
+
+        ConstIterator cend() const {
+            return ConstIterator(nullptr);
+        }
+
+        // Конструктор по умолчанию.
+        LinkedList() : LinkedList(Allocator()) {}
+
+        // Конструктор, принимающий аллокатор узлов.
+        explicit LinkedList(const Allocator& allocator)
+        : sizeOfList(0), head(nullptr), tail(nullptr), cursorNode(nullptr), cursorIndex(0), allocator(allocator) {}
+
+        // Пользовательский конструктор.
+        LinkedList(const std::initializer_list<T>& list, const Allocator& allocator = Allocator())
+        : LinkedList(allocator)
+        {
+            appendRange(list.begin(), list.end());
+        }
+
+        // Конструктор из диапазона [first, last): цепочка узлов строится за один проход.
+        template <typename InputIterator, typename = typename std::iterator_traits<InputIterator>::iterator_category>
+        LinkedList(InputIterator first, InputIterator last, const Allocator& allocator = Allocator())
+        : LinkedList(allocator)
+        {
+            appendRange(first, last);
+        }
+
+        // Конструктор глубокого копирования.
+        LinkedList(const LinkedList& other)
+        : LinkedList(Allocator(NodeTraits::select_on_container_copy_construction(other.allocator)))
+        {
+            // 1. Создаю временный указатель на узлы другого списка (для итерации по ним).
+            ListNode<T>* currentOther = other.head;
+
+            /* 2.   Итерируюсь по узлам другого списка, беру из них значения,
+                    и с помощью метода pushBack() добавляю новые узлы c взятыми значениями в свой список.  */
+            while (currentOther != nullptr)
+            {
+                this->pushBack(currentOther->value);
+                currentOther = currentOther->next;
+            }
+        }
+
+        // Конструктор копирования перемещением.
+        LinkedList(LinkedList&& other) noexcept
+        : sizeOfList(other.sizeOfList), head(other.head), tail(other.tail),
+          cursorNode(nullptr), cursorIndex(0), allocator(std::move(other.allocator)),
+          auxiliary(std::move(other.auxiliary))
+        {
+            // 1. С помощью списка инициализации я забираю ресурсы у объекта other.
+
+            /* 2.   Для объекта other я обнуляю размер списка, указатели на голову и хвост.
+                    Благодаря данным манипуляциям, деструктор объекта other не сможет освободить 
+                    занимаемые им ресурсы (см. реализацию деструктора). 
+
+                    Это полностью корректно, так как данными ресурсами теперь владеет наш список.  */
+            other.sizeOfList = 0;
+            other.head = nullptr;
+            other.tail = nullptr;
+            other.resetCursor();
+
+            // 3. Встроенные узлы остаются внутри объекта other - переношу их значения в наше хранилище.
+            relocateInlineNodes(other);
+        }
+
+        // Деструктор.
+        ~LinkedList() {
+            this->clear();
+        }
+
+        // Оператор глубокого копирования.
+        LinkedList& operator=(const LinkedList& other)
+        {
+            // 1. Если произошла попытка самоприсваивания - ничего не делаю.
+            if (this == &other) {
+                return *this;
+            }
+
+            // В противном случае:
+
+            // 2. Очищаю свой список с помощью метода clear() (который грамотно удаляет все узлы).
+            this->clear();
+
+            // 3. Если аллокатор должен копироваться вместе со списком - забираю аллокатор другого списка.
+            if constexpr (NodeTraits::propagate_on_container_copy_assignment::value) {
+                allocator = other.allocator;
+            }
+
+            // 4. Создаю временный указатель на узлы другого списка (для итерации по ним).
+            ListNode<T>* currentOther = other.head;
+
+            /* 5.   Итерируюсь по узлам другого списка, беру из них значения, 
+                    и с помощью метода pushBack() добавляю новые узлы c взятыми значениями в свой список.   */
+            while (currentOther != nullptr)
+            {
+                this->pushBack(currentOther->value);
+                currentOther = currentOther->next;
+            }
+
+            return *this;
+        }
+
+        // Оператор присваивания перемещением.
+        LinkedList& operator=(LinkedList&& other)
+            noexcept(NodeTraits::propagate_on_container_move_assignment::value || NodeTraits::is_always_equal::value)
+        {
+            // 1. Если произошла попытка самоприсваивания - ничего не делаю.
+            if (this == &other) {
+                return *this;
+            }
+
+            // В противном случае:
+
+            // 2. Очищаю свой список с помощью метода clear() (который грамотно удаляет все узлы).
+            this->clear();
+
+            /* 3.   Если аллокаторы не перемещаются вместе со списком и не равны, то узлы other
+                    нельзя освободить нашим аллокатором - в этом случае копирую значения поэлементно.  */
+            if constexpr (!NodeTraits::propagate_on_container_move_assignment::value)
+            {
+                if (allocator != other.allocator)
+                {
+                    // Блоки other остаются у него - переходят только настройки списка.
+                    copySettings(other);
+
+                    for (ListNode<T>* currentOther = other.head; currentOther != nullptr; currentOther = currentOther->next) {
+                        this->pushBack(std::move(currentOther->value));
+                    }
+
+                    other.clear();
+                    return *this;
+                }
+            }
+            else {
+                allocator = other.allocator;
+            }
+
+            // 4. Забираю ресурсы, которыми владеет объект other (в том числе блоки, в которых лежат его узлы). 
+            sizeOfList = other.sizeOfList;
+            head = other.head;
+            tail = other.tail;
+            auxiliary = std::move(other.auxiliary);
+
+            /* 5.   Для объекта other я обнуляю размер списка, указатели на голову и хвост.
+                    Благодаря данным манипуляциям, деструктор объекта other не сможет освободить 
+                    занимаемые им ресурсы (см. реализацию деструктора). 
+
+                    Это полностью корректно, так как данными ресурсами теперь владеет наш список.  */
+            other.sizeOfList = 0;
+            other.head = nullptr;
+            other.tail = nullptr;
+            other.resetCursor();
+
+            // 6. Встроенные узлы остаются внутри объекта other - переношу их значения в наше хранилище.
+            relocateInlineNodes(other);
+
+            return *this;
+        }
+
+        /*  Метод заменяет содержимое списка элементами диапазона [first, last) (цепочка строится за один проход).
+            Если конструктор элемента выбросит исключение, в списке останутся уже добавленные элементы.  */
+        template <typename InputIterator, typename = typename std::iterator_traits<InputIterator>::iterator_category>
+        void assign(InputIterator first, InputIterator last)
+        {
+            this->clear();
+            appendRange(first, last);
+        }
+
+        // Метод заменяет содержимое списка элементами list.
+        void assign(const std::initializer_list<T>& list) {
+            assign(list.begin(), list.end());
+        }
+
+        // Метод возвращает копию аллокатора, которым пользуется список.
+        Allocator getAllocator() const {
+            return Allocator(allocator);
+        }
+
+        // Метод возвращает политику статистики списка (для ListStats показания снимаются через snapshot()).
+        const Stats& getStats() const {
+            return stats;
+        }
+
+        /*
+        1.  Данный оператор предоставляет доступ к элементам списка по индексу (аналогично массивам).
+        2.  Доступна как положительная индексация (первый элемент имеет индекс 0),
+        так и отрицательная (последний элемент имеет индекс -1).
+        3.  Оператор возвращает элемент по ссылке.
+        4.  Список запоминает узел последнего обращения, поэтому последовательный обход по индексу
+        (list[0], list[1], ...) имеет амортизированную сложность O(1) на элемент, а обращение к
+        последнему элементу - O(1). Произвольный доступ по-прежнему имеет сложность O(n)
+        (для O(log n) см. IndexedLinkedList).
+        */
+        T& operator[](int index)
+        {
+            [[maybe_unused]] auto timer = stats.startTimer(ListOperation::Index);
+
+            // 1. Если значение индекса выходит за пределы - выбрасываю исключение.
+            if (index < -int(sizeOfList) || index >= int(sizeOfList)) {
+                throw std::out_of_range("Error! The index is out of range.");
+            }
+
+            // 2. Перевожу отрицательный индекс в положительный и нахожу узел (начиная с курсора, если это выгодно).
+            return nodeAt(index < 0 ? sizeOfList + index : size_t(index))->value;
+        }
+
+        /*  Метод показывает, является ли список пустым.
+            Возвращает соответствующее булевое значение.  */
+        bool isEmpty() const {
+            return head == nullptr;
+        }
+
+        // Метод возвращает длину списка на текущий момент.
+        size_t size() const {
+            return sizeOfList;
+        }
+
+        // Метод возвращает значение первого узла списка по ссылке.
+        T& front() const
+        {
+            // Если список пустой - невозможно обратиться к первому узлу (выбрасываю исключение).
+            if (head == nullptr) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the first element.");
+            }
+
+            return head->value;
+        }
+
+        // Метод возвращает значение последнего узла списка по ссылке.
+        T& back() const
+        {
+            // Если список пустой - невозможно обратиться к последнему узлу (выбрасываю исключение).
+            if (head == nullptr) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the last element.");
+            }
+
+            return tail->value;
+        }
+
+        // Метод выводит значения всех узлов в порядке их расположения в списке.
+        void print() const
+        {
+            ListNode<T>* tempPtr = head;
+
+            while (tempPtr != nullptr)
+            {
+                if (tempPtr->next != nullptr) {
+                    CONTAINERS_PREFETCH(tempPtr->next->next);
+                }
+
+                std::cout << tempPtr->value << ' ';
+                tempPtr = tempPtr->next;
+            }
+
+            std::cout << '\n';
+        }
+
+        /*  Метод записывает список в поток out в двоичном формате (см. ListFileHeader и ListSerializer):
+            заголовок с количеством элементов, затем элементы в порядке следования.
+            Тривиально копируемые значения пишутся сплошными порциями через буфер.
+            Поток должен быть открыт в двоичном режиме. При ошибке записи выбрасывает исключение.  */
+        void saveTo(std::ostream& out) const
+        {
+            using Serializer = ListSerializer<T>;
+
+            // 1. Записываю заголовок.
+            const ListFileHeader header(elementKindOf<T>(), Serializer::raw ? std::uint32_t(sizeof(T)) : 0, sizeOfList);
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+            // 2. Записываю значения.
+            if constexpr (Serializer::raw)
+            {
+                // 2.1. Собираю значения в буфер и записываю его целиком, когда он заполнится.
+                constexpr size_t chunkBytes = 64 * 1024;
+                constexpr size_t perChunk = sizeof(T) < chunkBytes ? chunkBytes / sizeof(T) : 1;
+
+                std::vector<char> buffer(perChunk * sizeof(T));
+                size_t filled = 0;
+
+                for (ListNode<T>* current = head; current != nullptr && out; current = current->next)
+                {
+                    if (current->next != nullptr) {
+                        CONTAINERS_PREFETCH(current->next->next);
+                    }
+
+                    std::memcpy(buffer.data() + filled * sizeof(T), std::addressof(current->value), sizeof(T));
+
+                    if (++filled == perChunk)
+                    {
+                        out.write(buffer.data(), std::streamsize(filled * sizeof(T)));
+                        filled = 0;
+                    }
+                }
+
+                out.write(buffer.data(), std::streamsize(filled * sizeof(T)));
+            }
+            else
+            {
+                for (ListNode<T>* current = head; current != nullptr && out; current = current->next) {
+                    Serializer::write(out, current->value);
+                }
+            }
+
+            if (!out) {
+                throw std::runtime_error("Error! Failed to write the list.");
+            }
+        }
+
+        // Метод записывает список в файл path (файл перезаписывается). При ошибке выбрасывает исключение.
+        void saveTo(const std::string& path) const
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+            if (!file) {
+                throw std::runtime_error("Error! Can't open the file " + path);
+            }
+
+            saveTo(file);
+            file.close();
+
+            if (!file) {
+                throw std::runtime_error("Error! Failed to write the file " + path);
+            }
+        }
+
+        /*  Метод заменяет содержимое списка элементами, прочитанными из потока in (формат saveTo()).
+            1.  Все узлы создаются в одном непрерывном блоке (как после compact()) и связываются за один проход,
+            тривиально копируемые значения читаются сплошными порциями.
+            2.  Поток остается сразу за прочитанным списком, поэтому несколько списков можно хранить подряд.
+            3.  Заголовок и количество элементов проверяются до того, как список очищается: если они неверны
+            (чужой формат, испорченный счетчик, данных в позиционируемом потоке меньше, чем заявлено),
+            выбрасывается исключение, а список не изменяется.
+            4.  Ошибка при чтении самих элементов (нехватка данных в непозиционируемом потоке, исключение
+            конструктора) выбрасывает исключение, а список остается пустым.  */
+        void loadFrom(std::istream& in)
+        {
+            using Serializer = ListSerializer<T>;
+
+            // 1. Читаю и проверяю заголовок (список пока не трогаю).
+            ListFileHeader header(ElementKind::Unspecified, 0, 0);
+
+            if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+                throw std::runtime_error("Error! The serialized list is truncated.");
+            }
+
+            header.validate(elementKindOf<T>(), Serializer::raw ? std::uint32_t(sizeof(T)) : 0);
+            header.validateCount(in, minRecordBytesOf<Serializer>::value);
+
+            if (header.count > NodeTraits::max_size(allocator)) {
+                throw std::length_error("Error! The serialized list is too long.");
+            }
+
+            // 2. Освобождаю текущие узлы: блок для новых узлов выделяется уже после них.
+            clear();
+
+            if (header.count == 0) {
+                return;
+            }
+
+            const size_t count = size_t(header.count);
+
+            // 3. Выделяю блок и конструирую в нем узлы по порядку.
+            CompactBlock* block = allocateBlock(count);
+            ListNode<T>* nodes = block->nodes;
+            size_t built = 0;
+
+            try
+            {
+                if constexpr (Serializer::raw)
+                {
+                    // 3.1. Читаю значения порциями в выровненный буфер и копирую их в узлы.
+                    using Storage = std::aligned_storage_t<sizeof(T), alignof(T)>;
+
+                    constexpr size_t chunkBytes = 64 * 1024;
+                    constexpr size_t perChunk = sizeof(T) < chunkBytes ? chunkBytes / sizeof(T) : 1;
+
+                    std::vector<Storage> buffer(std::min(perChunk, count));
+
+                    while (built < count)
+                    {
+                        const size_t portion = std::min(buffer.size(), count - built);
+
+                        if (!in.read(reinterpret_cast<char*>(buffer.data()), std::streamsize(portion * sizeof(T)))) {
+                            throw std::runtime_error("Error! The serialized list is truncated.");
+                        }
+
+                        for (size_t i = 0; i < portion; ++i, ++built) {
+                            NodeTraits::construct(allocator, nodes + built, std::in_place,
+                                                  *std::launder(reinterpret_cast<const T*>(buffer.data() + i)));
+                        }
+                    }
+                }
+                else
+                {
+                    for (; built < count; ++built) {
+                        NodeTraits::construct(allocator, nodes + built, std::in_place, Serializer::read(in));
+                    }
+                }
+            }
+            catch (...)
+            {
+                discardBlock(block, built);
+                throw;
+            }
+
+            // 4. Связываю узлы блока по порядку (блок - одно выделение памяти).
+            linkBlock(block);
+            stats.onAllocate(count);
+
+            auxiliary->freedSinceCompact = 0;
+        }
+
+        // Метод заменяет содержимое списка элементами из файла path (формат saveTo()).
+        void loadFrom(const std::string& path)
+        {
+            std::ifstream file(path, std::ios::binary);
+
+            if (!file) {
+                throw std::runtime_error("Error! Can't open the file " + path);
+            }
+
+            loadFrom(file);
+        }
+
+        /*  Метод ищет первый узел со значением value и возвращает указатель 
+            на значение этого узла. Если узел не найден - возвращает nullptr.  */
+        T* find(const T& value) const
+        {
+            [[maybe_unused]] auto timer = stats.startTimer(ListOperation::Find);
+
+            ListNode<T>* tempPtr = head;
+            size_t visited = 0;
+
+            while (tempPtr != nullptr)
+            {
+                ++visited;
+
+                if (tempPtr->next != nullptr) {
+                    CONTAINERS_PREFETCH(tempPtr->next->next);
+                }
+
+                if (tempPtr->value == value)
+                {
+                    stats.onTraverse(ListOperation::Find, visited);
+                    return &tempPtr->value;
+                }
+
+                tempPtr = tempPtr->next;
+            }
+
+            stats.onTraverse(ListOperation::Find, visited);
+
+            return nullptr;
+        }
+
+        /*  Метод проверяет, есть ли в списке узел со значением value.
+            Возвращает соответствующее булевое значение.  */
+        bool contains(const T& value) const {
+            return find(value) != nullptr;
+        }
+
+        /*  Метод сортирует список по возрастанию (или в порядке, заданном компаратором compare).
+            1.  Используется восходящая сортировка слиянием со сложностью O(n log n).
+            2.  Сортировка устойчивая: равные элементы сохраняют свой взаимный порядок.
+            3.  Значения не копируются и не перемещаются - перестраиваются только указатели next,
+            поэтому указатели и итераторы на элементы остаются действительными.  */
+        template <typename Compare = std::less<>,
+                  typename = std::enable_if_t<!execution::is_execution_policy_v<Compare>>>
+        void sort(Compare compare = Compare())
+        {
+            // 1. Если в списке меньше 2-х элементов - сортировать ничего не нужно.
+            if (sizeOfList < 2) {
+                return;
+            }
+
+            [[maybe_unused]] auto timer = stats.startTimer(ListOperation::Sort);
+
+            // 2. Сортирую цепочку узлов и запоминаю ее новый хвост (при сборе статистики - считая сравнения).
+            if constexpr (Stats::enabled)
+            {
+                size_t comparisons = 0;
+
+                auto countingCompare = [&compare, &comparisons](const T& left, const T& right) {
+                    ++comparisons;
+                    return compare(left, right);
+                };
+
+                head = sortChain(head, tail, countingCompare);
+                stats.onCompare(comparisons);
+            }
+            else {
+                head = sortChain(head, tail, compare);
+            }
+
+            resetCursor();
+        }
+
+        /*  Параллельная версия сортировки (policy - execution::seq или execution::par).
+            1.  Для execution::par список сортируется на общем пуле WorkStealingPool::instance() (см. sort(pool, compare)).
+            2.  Для execution::seq выполняется обычная сортировка.  */
+        template <typename ExecutionPolicy, typename Compare = std::less<>,
+                  typename = std::enable_if_t<execution::is_execution_policy_v<ExecutionPolicy>>>
+        void sort(ExecutionPolicy&&, Compare compare = Compare())
+        {
+            if (std::is_same_v<std::decay_t<ExecutionPolicy>, execution::sequenced_policy>) {
+                sort(compare);
+            }
+            else {
+                sort(WorkStealingPool::instance(), compare);
+            }
+        }
+
+        /*  Сортировка на потоках пула pool.
+            1.  Список разрезается на отрезки по числу потоков пула, каждый отрезок сортируется слиянием
+            отдельной задачей пула, после чего отрезки попарно сливаются (тоже параллельно).
+            2.  Для коротких списков и для пула из одного потока выполняется обычная сортировка.
+            3.  Важно! Компаратор вызывается из нескольких потоков одновременно и должен это допускать.  */
+        template <typename Compare = std::less<>>
+        void sort(WorkStealingPool& pool, Compare compare = Compare())
+        {
+            // 1. Определяю количество отрезков (каждый отрезок должен быть достаточно длинным, чтобы окупить задачу).
+            const size_t minSegmentLength = 16384;
+            const size_t segmentCount = std::min(pool.concurrency(), sizeOfList / minSegmentLength);
+
+            if (segmentCount < 2)
+            {
+                sort(compare);
+                return;
+            }
+
+            [[maybe_unused]] auto timer = stats.startTimer(ListOperation::Sort);
+
+            // 2. Разрезаю цепочку на segmentCount отрезков почти равной длины.
+            std::vector<ListNode<T>*> heads(segmentCount);
+            std::vector<ListNode<T>*> tails(segmentCount);
+
+            ListNode<T>* current = head;
+
+            for (size_t segment = 0; segment < segmentCount; ++segment)
+            {
+                const size_t length = sizeOfList / segmentCount + (segment < sizeOfList % segmentCount);
+
+                heads[segment] = current;
+
+                for (size_t i = 1; i < length; ++i) {
+                    current = current->next;
+                }
+
+                tails[segment] = current;
+                current = current->next;
+                tails[segment]->next = nullptr;
+            }
+
+            // При сборе статистики сравнения считаются (каждый поток - в свой счетчик).
+            std::vector<size_t> comparisons(Stats::enabled ? segmentCount : 0);
+
+            auto sortSegment = [&](ListNode<T>*& segmentHead, ListNode<T>*& segmentTail, size_t segment) {
+                if constexpr (Stats::enabled)
+                {
+                    size_t counted = 0;
+                    auto countingCompare = [&compare, &counted](const T& left, const T& right) {
+                        ++counted;
+                        return compare(left, right);
+                    };
+
+                    segmentHead = sortChain(segmentHead, segmentTail, countingCompare);
+                    comparisons[segment] += counted;
+                }
+                else {
+                    segmentHead = sortChain(segmentHead, segmentTail, compare);
+                }
+            };
+
+            auto mergeSegments = [&](size_t left, size_t right) {
+                if constexpr (Stats::enabled)
+                {
+                    size_t counted = 0;
+                    auto countingCompare = [&compare, &counted](const T& first, const T& second) {
+                        ++counted;
+                        return compare(first, second);
+                    };
+
+                    heads[left] = mergeChains(heads[left], heads[right], tails[left], countingCompare);
+                    comparisons[left] += counted;
+                }
+                else {
+                    heads[left] = mergeChains(heads[left], heads[right], tails[left], compare);
+                }
+            };
+
+            // 3. Сортирую отрезки параллельно.
+            pool.parallelFor(segmentCount, [&](size_t segment) {
+                sortSegment(heads[segment], tails[segment], segment);
+            });
+
+            // 4. Попарно сливаю соседние отрезки, пока не останется один (соседство сохраняет устойчивость).
+            for (size_t step = 1; step < segmentCount; step *= 2)
+            {
+                pool.parallelFor((segmentCount + 2 * step - 1) / (2 * step), [&](size_t pair) {
+                    const size_t left = pair * 2 * step;
+                    const size_t right = left + step;
+
+                    if (right < segmentCount) {
+                        mergeSegments(left, right);
+                    }
+                });
+            }
+
+            if constexpr (Stats::enabled)
+            {
+                size_t total = 0;
+
+                for (size_t counted : comparisons) {
+                    total += counted;
+                }
+
+                stats.onCompare(total);
+            }
+
+            head = heads[0];
+            tail = tails[0];
+            resetCursor();
+        }
+
+        /*  Метод сливает в список отсортированный (по compare) список other, оставляя other пустым.
+            1.  Список тоже должен быть отсортирован по compare - тогда результат отсортирован.
+            2.  Слияние устойчивое: при равенстве элементы нашего списка идут раньше элементов other.
+            3.  Узлы other переносятся без копирования значений за O(n + m). Если аллокаторы не равны,
+            значения other сначала перемещаются в новые узлы нашего аллокатора.  */
+        template <typename Compare = std::less<>>
+        void merge(LinkedList&& other, Compare compare = Compare())
+        {
+            if (&other == this || other.head == nullptr) {
+                return;
+            }
+
+            // 1. Узлы, которые наш аллокатор не сможет освободить, заменяю своими.
+            if (!canAdoptNodes(other))
+            {
+                LinkedList moved(getAllocator());
+                moved.appendRange(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                other.clear();
+                merge(std::move(moved), compare);
+                return;
+            }
+
+            other.spillInlineNodes(nullptr, nullptr);
+            adoptBlocks(other);
+
+            // 2. Сливаю цепочки (при сборе статистики - считая сравнения).
+            ListNode<T>* mergedTail = tail;
+
+            if (head == nullptr)
+            {
+                head = other.head;
+                mergedTail = other.tail;
+            }
+            else if constexpr (Stats::enabled)
+            {
+                size_t comparisons = 0;
+
+                auto countingCompare = [&compare, &comparisons](const T& left, const T& right) {
+                    ++comparisons;
+                    return compare(left, right);
+                };
+
+                head = mergeChains(head, other.head, mergedTail, countingCompare);
+                stats.onCompare(comparisons);
+            }
+            else {
+                head = mergeChains(head, other.head, mergedTail, compare);
+            }
+
+            tail = mergedTail;
+            sizeOfList += other.sizeOfList;
+            resetCursor();
+
+            other.releaseTransferredNodes();
+        }
+
+        /*  Метод полностью очищает список (его же вызывает деструктор).
+            1.  Узлы разрушаются одним проходом по цепочке: значения не извлекаются, а размер и хвост
+            обновляются один раз в конце.
+            2.  В режиме отложенного освобождения (см. setDeferredReclamation()) цепочка целиком
+            передается фоновому потоку за O(1), а узлы из собственного пула PoolAllocator освобождаются сбросом пула.  */
+        void clear()
+        {
+            // 1. Отложенное освобождение (если узлы удалось освободить сбросом пула или передать фоновому потоку).
+            if (head != nullptr && auxiliary != nullptr && auxiliary->deferredReclamation)
+            {
+                // Тривиально разрушаемые узлы собственного пула освобождаются сбросом пула сразу (за O(число чанков)).
+                if (ownsArena() && std::is_trivially_destructible_v<T>)
+                {
+                    resetArena();
+                    return;
+                }
+
+                if (deferToReclaimer()) {
+                    return;
+                }
+            }
+
+            // 2. Обычное освобождение: прохожу по цепочке и разрушаю узлы.
+            destroyChain();
+        }
+
+        /*  Метод переносит все узлы в один непрерывный блок памяти в порядке их следования по списку.
+            1.  После долгой череды добавлений и удалений узлы разбросаны по куче, и обход списка
+            упирается в задержки памяти. После компактизации обход идет по последовательным адресам.
+            2.  Значения перемещаются (или копируются, если перемещение может выбросить исключение),
+            поэтому указатели, ссылки и итераторы на элементы становятся недействительными.
+            Если исключение все же возникло - список остается прежним.
+            3.  Освобожденные позже узлы блока не переиспользуются: блок возвращается аллокатору целиком,
+            когда из него удаляется последний узел (или при следующей компактизации).  */
+        void compact()
+        {
+            if (sizeOfList == 0)
+            {
+                if (auxiliary != nullptr) {
+                    auxiliary->freedSinceCompact = 0;
+                }
+
+                return;
+            }
+
+            // 1. Выделяю блок.
+            CompactBlock* block = allocateBlock(sizeOfList);
+            ListNode<T>* nodes = block->nodes;
+
+            // 2. Переношу значения в блок в порядке следования узлов.
+            size_t built = 0;
+
+            try
+            {
+                for (ListNode<T>* current = head; current != nullptr; current = current->next, ++built) {
+                    NodeTraits::construct(allocator, nodes + built, std::in_place, std::move_if_noexcept(current->value));
+                }
+            }
+            catch (...)
+            {
+                discardBlock(block, built);
+                throw;
+            }
+
+            // 3. Разрушаю старые узлы и снимаю ссылки со старых блоков.
+            for (ListNode<T>* current = head; current != nullptr;)
+            {
+                ListNode<T>* next = current->next;
+                NodeTraits::destroy(allocator, current);
+                releaseNodeMemory(current);
+                current = next;
+            }
+
+            while (hasBlocks()) {
+                releaseBlock(auxiliary->blocks.back());
+            }
+
+            // 4. Связываю узлы блока по порядку (курсор остается на узле с тем же индексом).
+            linkBlock(block);
+            stats.onAllocate(sizeOfList);
+
+            if (cursorNode != nullptr) {
+                cursorNode = nodes + cursorIndex;
+            }
+
+            auxiliary->freedSinceCompact = 0;
+        }
+
+        /*  Метод включает автоматическую компактизацию: она выполняется при добавлении элемента
+            (pushFront, pushBack, emplaceFront, emplaceBack), когда с момента предыдущей компактизации
+            освобождено не меньше churnRatio * size() узлов, а длина списка не меньше minLength.
+            churnRatio == 0 выключает автоматическую компактизацию.
+            Важно! При включенном режиме добавление элемента может сделать недействительными
+            указатели, ссылки и итераторы на остальные элементы.  */
+        void setAutoCompact(double churnRatio, size_t minLength = 4096)
+        {
+            // Выключение автоматической компактизации не требует создавать ее состояние.
+            if (churnRatio == 0 && auxiliary == nullptr) {
+                return;
+            }
+
+            AuxiliaryState& state = auxiliaryState();
+            state.autoCompactRatio = churnRatio;
+            state.autoCompactMinLength = minLength;
+        }
+
+        /*  Метод включает (или выключает) режим отложенного освобождения узлов для clear() и деструктора.
+            1.  Обычный аллокатор: цепочка за O(1) передается фоновому потоку NodeReclaimer. Аллокатор должен допускать
+            освобождение памяти из другого потока, а его ресурс - пережить NodeReclaimer::instance().drain().
+            2.  PoolAllocator, пул которого принадлежит только этому списку: пул сбрасывается целиком
+            (для тривиально разрушаемых T - за O(число чанков)). Если пул разделяется с другими списками,
+            узлы освобождаются как обычно (пул не допускает работы из другого потока).  */
+        void setDeferredReclamation(bool enabled)
+        {
+            // Выключение режима не требует создавать состояние.
+            if (enabled || auxiliary != nullptr) {
+                auxiliaryState().deferredReclamation = enabled;
+            }
+        }
+
+        /*  Метод удаляет первый узел со значением valueToRemove.
+            Возвращает true, если узел с соответствующим значением был найден и удалён, иначе - false.  */
+        bool remove(const T& valueToRemove)
+        {
+            [[maybe_unused]] auto timer = stats.startTimer(ListOperation::Remove);
+
+            // Удаление сдвигает индексы узлов, поэтому курсор становится недействительным.
+            resetCursor();
+
+            // 1. Если список пустой - невозможно ничего удалить (возвращаю false).
+            if (head == nullptr) {
+                return false;
+            }
+
+            // 2. Если нужно удалить первый элемент (без popFront(), чтобы вызов не попал в статистику popFront):
+            if (head->value == valueToRemove)
+            {
+                stats.onTraverse(ListOperation::Remove, 1);
+                removeHead();
+                return true;
+            }
+
+            // В противном случае:
+
+            // 3. Создаю временный указатель для итерации по списку (сначала tempPtr указывает на первый узел).
+            ListNode<T>* tempPtr = head;
+            size_t visited = 1;
+
+            /* 4. Данный цикл закончится в двух случаях:
+                1) Указатель tempPtr указывает на последний узел списка.
+                2) Следующий узел после tempPtr содержит значение, которое необходимо удалить. */
+            while (tempPtr->next != nullptr && tempPtr->next->value != valueToRemove)
+            {
+                CONTAINERS_PREFETCH(tempPtr->next->next);
+                tempPtr = tempPtr->next;
+                ++visited;
+            }
+
+            // Узел со значением valueToRemove (если он найден) тоже был просмотрен.
+            stats.onTraverse(ListOperation::Remove, tempPtr->next != nullptr ? visited + 1 : visited);
+
+            /* ОБЪЯСНЕНИЕ ПУНКТА 4.
+
+            ПЕРВЫЙ СЛУЧАЙ:
+            - Цикл заканчивается, когда tempPtr->next == nullptr.
+            - Это означает, что tempPtr указывает на последний узел списка.
+            - В этом случае, значение valueToRemove не было найдено в оставшейся части списка.
+
+            ВТОРОЙ СЛУЧАЙ:
+            - Цикл заканчивается, когда tempPtr->next->value == valueToRemove.
+            - Это означает, что следующий узел после tempPtr содержит значение, которое необходимо удалить.
+            - В этом случае, tempPtr является предыдущим узлом по отношению к узлу, который необходимо удалить. */
+
+            // 5. Если я вышел из цикла из-за первого случая -> значит, я ничего не нашел -> возвращаю false.
+            if (tempPtr->next == nullptr) {
+                return false;
+            }
+
+            // Если я зашел сюда, значит узел, следующий за tempPtr, необходимо удалить.
+
+            // 6. Создаю указатель на узел, который необходимо удалить.
+            ListNode<T>* nodeToRemove = tempPtr->next;
+
+            // 7. Теперь текущий узел должен показывать на узел, на который показывал удаляемый узел.
+            tempPtr->next = nodeToRemove->next;
+
+            // 8. Удаляю узел со значением valueToRemove.
+            destroyNode(nodeToRemove);
+
+            // 9. Если я удалил последний узел, то необходимо обновить хвост.
+            if (tempPtr->next == nullptr) {
+                tail = tempPtr;
+            }
+
+            --sizeOfList;
+
+            return true;
+        }
+
+        /*  Метод удаляет все узлы со значением valueToRemove за один проход по списку.
+            Возвращает true, если хотя бы один узел был удалён, иначе - false. */
+        bool removeAll(const T& valueToRemove) {
+            return removeIf([&valueToRemove](const T& value) { return value == valueToRemove; }) != 0;
+        }
+
+        /*  Метод удаляет все узлы, значения которых удовлетворяют предикату predicate.
+            1.  Список проходится ровно один раз, хвост обновляется один раз в конце.
+            2.  Возвращает количество удаленных узлов.  */
+        template <typename Predicate>
+        size_t removeIf(Predicate predicate)
+        {
+            [[maybe_unused]] auto timer = stats.startTimer(ListOperation::Remove);
+
+            const size_t oldSize = sizeOfList;
+            resetCursor();
+            stats.onTraverse(ListOperation::Remove, oldSize);
+
+            /* 1.   link - указатель на поле, которое указывает на текущий узел (сначала это head).
+                    Благодаря этому удаление первого узла не требует отдельной обработки.  */
+            ListNode<T>** link = &head;
+
+            // 2. Последний из оставшихся в списке узлов (станет новым хвостом).
+            ListNode<T>* lastKept = nullptr;
+
+            // 3. Прохожу по списку: подходящие узлы выкусываю, остальные пропускаю.
+            while (*link != nullptr)
+            {
+                ListNode<T>* current = *link;
+
+                if (predicate(current->value))
+                {
+                    *link = current->next;
+                    destroyNode(current);
+                    --sizeOfList;
+                }
+                else
+                {
+                    lastKept = current;
+                    link = &current->next;
+                }
+            }
+
+            // 4. Обновляю хвост.
+            tail = lastKept;
+
+            return oldSize - sizeOfList;
+        }
+
+        /*  Метод удаляет узел, следующий за узлом, на который смотрит position.
+            Возвращает итератор на узел, следующий за удаленным.
+            Если за position нет узла - выбрасывает исключение.  */
+        Iterator eraseAfter(Iterator position)
+        {
+            if (position.pointerToNode == nullptr || position.pointerToNode->next == nullptr) {
+                throw std::out_of_range("Error! There is no element after the given position.");
+            }
+
+            return eraseAfter(position, Iterator(position.pointerToNode->next->next));
+        }
+
+        /*  Метод удаляет все узлы, лежащие строго между first и last (то есть интервал (first, last)).
+            1.  Отрезок выкусывается из списка одной перестановкой указателя, после чего его узлы освобождаются.
+            2.  Возвращает last.  */
+        Iterator eraseAfter(Iterator first, Iterator last)
+        {
+            if (first.pointerToNode == nullptr) {
+                throw std::out_of_range("Error! There is no element after the given position.");
+            }
+
+            ListNode<T>* current = first.pointerToNode->next;
+            resetCursor();
+
+            // 1. Отцепляю отрезок: first теперь показывает сразу на last.
+            first.pointerToNode->next = last.pointerToNode;
+
+            // 2. Если отрезок доходил до конца списка - хвостом становится first.
+            if (last.pointerToNode == nullptr) {
+                tail = first.pointerToNode;
+            }
+
+            // 3. Освобождаю узлы отрезка.
+            while (current != last.pointerToNode)
+            {
+                ListNode<T>* next = current->next;
+                destroyNode(current);
+                --sizeOfList;
+                current = next;
+            }
+
+            return last;
+        }
+
+        /*  Метод переносит все узлы other в конец списка за O(1), оставляя other пустым.
+            Значения не копируются, поэтому указатели и итераторы на элементы other остаются действительными
+            (теперь они указывают на элементы нашего списка). Если аллокаторы не равны, значения перемещаются поэлементно.  */
+        void append(LinkedList&& other)
+        {
+            if (&other == this || other.head == nullptr) {
+                return;
+            }
+
+            if (!canAdoptNodes(other))
+            {
+                appendRange(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                other.clear();
+                return;
+            }
+
+            other.spillInlineNodes(nullptr, nullptr);
+            adoptBlocks(other);
+
+            if (tail != nullptr) {
+                tail->next = other.head;
+            }
+            else {
+                head = other.head;
+            }
+
+            tail = other.tail;
+            sizeOfList += other.sizeOfList;
+
+            other.releaseTransferredNodes();
+        }
+
+        /*  Метод переносит все узлы other в начало списка за O(1), оставляя other пустым.
+            Если аллокаторы не равны, значения перемещаются поэлементно.  */
+        void prepend(LinkedList&& other)
+        {
+            if (&other == this || other.head == nullptr) {
+                return;
+            }
+
+            if (!canAdoptNodes(other))
+            {
+                LinkedList moved(getAllocator());
+                moved.appendRange(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+                other.clear();
+                prepend(std::move(moved));
+                return;
+            }
+
+            other.spillInlineNodes(nullptr, nullptr);
+            adoptBlocks(other);
+
+            other.tail->next = head;
+
+            if (tail == nullptr) {
+                tail = other.tail;
+            }
+
+            head = other.head;
+            sizeOfList += other.sizeOfList;
+
+            // Все узлы сдвинулись вправо на длину other - сдвигаю и индекс курсора.
+            if (cursorNode != nullptr) {
+                cursorIndex += other.sizeOfList;
+            }
+
+            other.releaseTransferredNodes();
+        }
+
+        /*  Метод переносит узлы, лежащие строго между first и last (интервал (first, last)) списка other,
+            в наш список сразу после узла position (по аналогии с std::forward_list::splice_after).
+            1.  Узлы перевешиваются без копирования значений; сложность - O(k), где k - длина отрезка
+            (его нужно пройти, чтобы найти последний узел и посчитать длину).
+            2.  other может совпадать с нашим списком, но position не должен лежать внутри (first, last).
+            3.  Если аллокаторы не равны, значения отрезка перемещаются в новые узлы.
+            4.  Если position или first не указывают на узел - выбрасывает исключение.  */
+        void spliceAfter(Iterator position, LinkedList& other, Iterator first, Iterator last)
+        {
+            if (position.pointerToNode == nullptr || first.pointerToNode == nullptr) {
+                throw std::out_of_range("Error! There is no element after the given position.");
+            }
+
+            if (first.pointerToNode->next == last.pointerToNode || position == first) {
+                return;
+            }
+
+            // 1. Узлы, которые наш аллокатор не сможет освободить, заменяю своими.
+            if (!canAdoptNodes(other))
+            {
+                LinkedList moved(getAllocator());
+                moved.appendRange(std::make_move_iterator(Iterator(first.pointerToNode->next)), std::make_move_iterator(last));
+                other.eraseAfter(first, last);
+                moved.spillInlineNodes(nullptr, nullptr);
+
+                linkAfter(position.pointerToNode, moved.head, moved.tail, moved.sizeOfList);
+                moved.releaseTransferredNodes();
+                return;
+            }
+
+            if (&other != this) {
+                other.spillInlineNodes(first.pointerToNode, last.pointerToNode);
+            }
+
+            // 2. Нахожу последний узел отрезка и считаю его длину.
+            ListNode<T>* rangeFirst = first.pointerToNode->next;
+            ListNode<T>* rangeLast = rangeFirst;
+            size_t count = 1;
+
+            while (rangeLast->next != last.pointerToNode)
+            {
+                rangeLast = rangeLast->next;
+                ++count;
+            }
+
+            adoptBlocks(other);
+
+            // 3. Вырезаю отрезок из other.
+            first.pointerToNode->next = last.pointerToNode;
+
+            if (last.pointerToNode == nullptr) {
+                other.tail = first.pointerToNode;
+            }
+
+            other.sizeOfList -= count;
+            other.resetCursor();
+
+            // 4. Подвешиваю отрезок после position.
+            linkAfter(position.pointerToNode, rangeFirst, rangeLast, count);
+        }
+
+        // Метод переносит один узел, следующий за first в списке other, в наш список сразу после position.
+        void spliceAfter(Iterator position, LinkedList& other, Iterator first)
+        {
+            if (first.pointerToNode == nullptr || first.pointerToNode->next == nullptr) {
+                throw std::out_of_range("Error! There is no element after the given position.");
+            }
+
+            spliceAfter(position, other, first, Iterator(first.pointerToNode->next->next));
+        }
+
+        /*  Метод отделяет от списка все узлы, следующие за position, и возвращает их в виде нового списка
+            (position остается последним узлом). Сложность - O(k), где k - длина отделяемой части
+            (ее нужно посчитать). Если position не указывает на узел - выбрасывает исключение.  */
+        LinkedList splitAt(Iterator position)
+        {
+            if (position.pointerToNode == nullptr) {
+                throw std::out_of_range("Error! The iterator does not point to an element.");
+            }
+
+            LinkedList suffix(getAllocator());
+
+            if (position.pointerToNode->next == nullptr) {
+                return suffix;
+            }
+
+            // Встроенные узлы не могут перейти в другой объект - переношу их значения в узлы аллокатора.
+            spillInlineNodes(position.pointerToNode, nullptr);
+
+            // 1. Суффикс может лежать в наших блоках - он ссылается на них так же, как и мы.
+            suffix.adoptBlocks(*this);
+
+            // 2. Считаю длину суффикса и отрезаю его.
+            size_t suffixSize = 0;
+
+            for (ListNode<T>* current = position.pointerToNode->next; current != nullptr; current = current->next) {
+                ++suffixSize;
+            }
+
+            suffix.head = position.pointerToNode->next;
+            suffix.tail = tail;
+            suffix.sizeOfList = suffixSize;
+
+            position.pointerToNode->next = nullptr;
+            tail = position.pointerToNode;
+            sizeOfList -= suffixSize;
+
+            if (cursorNode != nullptr && cursorIndex >= sizeOfList) {
+                resetCursor();
+            }
+
+            return suffix;
+        }
+
+        // Метод добавляет новый элемент в начало списка.
+        void pushFront(const T& value) {
+            emplaceFront(value);
+        }
+
+        // Метод добавляет новый элемент в начало списка, перемещая в него value.
+        void pushFront(T&& value) {
+            emplaceFront(std::move(value));
+        }
+
+        // Метод добавляет новый элемент в конец списка.
+        void pushBack(const T& value) {
+            emplaceBack(value);
+        }
+
+        // Метод добавляет новый элемент в конец списка, перемещая в него value.
+        void pushBack(T&& value) {
+            emplaceBack(std::move(value));
+        }
+
+        /*  Метод конструирует новый элемент в начале списка прямо в узле (из аргументов args).
+            Возвращает ссылку на созданный элемент.  */
+        template <typename... Args>
+        T& emplaceFront(Args&&... args)
+        {
+            [[maybe_unused]] auto timer = stats.startTimer(ListOperation::PushFront);
+            return linkFront(createNode(std::forward<Args>(args)...));
+        }
+
+        /*  Метод конструирует новый элемент в конце списка прямо в узле (из аргументов args).
+            Возвращает ссылку на созданный элемент.  */
+        template <typename... Args>
+        T& emplaceBack(Args&&... args)
+        {
+            [[maybe_unused]] auto timer = stats.startTimer(ListOperation::PushBack);
+            return linkBack(createNode(std::forward<Args>(args)...));
+        }
+
+    private:
+        /*  Метод подвешивает новый узел newNode в начало списка и возвращает ссылку на его значение.
+            Статистику вызова ведет вызывающий метод (emplaceFront() или emplaceAt()).  */
+        T& linkFront(ListNode<T>* newNode)
+        {
+            // 1. Новый узел должен показывать на первый узел списка.
+            newNode->next = head;
+
+            // 2. Голова, в свою очередь, теперь должна показывать на новый узел.
+            head = newNode;
+
+            // 3. Если список был пустым - хвост должен показывать на новый узел.
+            if (tail == nullptr) {
+                tail = newNode;
+            }
+
+            // 4. Все узлы сдвинулись на одну позицию вправо - сдвигаю и индекс курсора.
+            if (cursorNode != nullptr) {
+                ++cursorIndex;
+            }
+
+            ++sizeOfList;
+
+            // 5. Компактизация (если она включена) переносит и новый узел - он по-прежнему первый.
+            compactIfFragmented();
+
+            return head->value;
+        }
+
+        /*  Метод подвешивает новый узел newNode в конец списка и возвращает ссылку на его значение.
+            Статистику вызова ведет вызывающий метод (emplaceBack() или emplaceAt()).  */
+        T& linkBack(ListNode<T>* newNode)
+        {
+            // 1. Если список пустой - новый узел становится как головой, так и хвостом.
+            if (head == nullptr)
+            {
+                head = newNode;
+                tail = newNode;
+            }
+            else
+            {
+                // Если список не пустой:
+
+                // 2. Последний узел списка должен показывать на новый узел.
+                tail->next = newNode;
+
+                /* 2.1. Указатель на хвост должен показывать на новый узел 
+                        (так как теперь новый узел - последний в списке). */
+                tail = newNode;
+            }
+
+            ++sizeOfList;
+
+            // 3. Компактизация (если она включена) переносит и новый узел - он по-прежнему последний.
+            compactIfFragmented();
+
+            return tail->value;
+        }
+
+        /*  Метод удаляет первый узел непустого списка (значение из узла должно быть уже перемещено, если оно нужно).
+            Статистику вызова ведет вызывающий метод (popFront(), eraseAt() или remove()).  */
+        void removeHead()
+        {
+            // 1. Курсор, стоящий на первом узле, сбрасываю, остальные - сдвигаю на позицию влево.
+            if (cursorNode == head) {
+                resetCursor();
+            }
+            else if (cursorNode != nullptr) {
+                --cursorIndex;
+            }
+
+            // 2. Сохраняю указатель на второй узел (так как он впоследствии станет первым).
+            ListNode<T>* second = head->next;
+
+            // 3. Удаляю первый узел.
+            destroyNode(head);
+
+            // 4. Направляю указатель на голову на второй узел.
+            head = second;
+
+            // 5. Если список стал пустым - обнуляю указатель на хвост.
+            if (head == nullptr) {
+                tail = nullptr;
+            }
+
+            --sizeOfList;
+        }
+
+    public:
+
+        // Метод вставляет элемент со значением value так, чтобы он получил индекс index (0 <= index <= size()).
+        void insertAt(size_t index, const T& value) {
+            emplaceAt(index, value);
+        }
+
+        void insertAt(size_t index, T&& value) {
+            emplaceAt(index, std::move(value));
+        }
+
+        /*  Метод конструирует элемент из аргументов args так, чтобы он получил индекс index (0 <= index <= size()).
+            Предыдущий узел ищется с учетом курсора, поэтому последовательные вставки "подряд" дешевы.
+            Возвращает ссылку на созданный элемент.  */
+        template <typename... Args>
+        T& emplaceAt(size_t index, Args&&... args)
+        {
+            [[maybe_unused]] auto timer = stats.startTimer(ListOperation::Insert);
+
+            // 1. Если значение индекса выходит за пределы - выбрасываю исключение.
+            if (index > sizeOfList) {
+                throw std::out_of_range("Error! The index is out of range.");
+            }
+
+            // 2. Вставка в начало и в конец списка не требует поиска позиции.
+            if (index == 0) {
+                return linkFront(createNode(std::forward<Args>(args)...));
+            }
+
+            if (index == sizeOfList) {
+                return linkBack(createNode(std::forward<Args>(args)...));
+            }
+
+            // 3. Нахожу предыдущий узел и подвешиваю новый узел после него (курсор остается на предыдущем узле).
+            ListNode<T>* previous = nodeAt(index - 1, ListOperation::Insert);
+            ListNode<T>* newNode = createNode(std::forward<Args>(args)...);
+
+            newNode->next = previous->next;
+            previous->next = newNode;
+
+            ++sizeOfList;
+
+            return newNode->value;
+        }
+
+        /*  Метод удаляет элемент с индексом index (0 <= index < size()).
+            Возвращает значение удаленного элемента.  */
+        T eraseAt(size_t index)
+        {
+            [[maybe_unused]] auto timer = stats.startTimer(ListOperation::Erase);
+
+            // 1. Если значение индекса выходит за пределы - выбрасываю исключение.
+            if (index >= sizeOfList) {
+                throw std::out_of_range("Error! The index is out of range.");
+            }
+
+            // 2. Первый элемент удаляется без поиска позиции.
+            if (index == 0)
+            {
+                T deleted = std::move(head->value);
+                removeHead();
+                return deleted;
+            }
+
+            // 3. Нахожу предыдущий узел и выкусываю следующий за ним (курсор остается на предыдущем узле).
+            ListNode<T>* previous = nodeAt(index - 1, ListOperation::Erase);
+            ListNode<T>* nodeToRemove = previous->next;
+
+            T deleted = std::move(nodeToRemove->value);
+
+            previous->next = nodeToRemove->next;
+
+            if (nodeToRemove == tail) {
+                tail = previous;
+            }
+
+            destroyNode(nodeToRemove);
+            --sizeOfList;
+
+            return deleted;
+        }
+
+        /*  Метод удаляет первый элемент из списка.
+            Возвращает значение удаленного элемента (значение перемещается из узла, а не копируется).  */
+        T popFront()
+        {
+            [[maybe_unused]] auto timer = stats.startTimer(ListOperation::PopFront);
+
+            /* 1.   Проверяю список на пустоту. 
+                    Если список пустой - невозможно ничего удалить (выбрасываю исключение).   */
+            if (head == nullptr) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+        
+            // 2. Перемещаю значение из удаляемого узла.
+            T deleted = std::move(head->value);
+
+            // 3. Удаляю первый узел.
+            removeHead();
+
+            return deleted;
+        }
+
+        /*  Метод удаляет последний элемент из списка.
+            Возвращает значение удаленного элемента (значение перемещается из узла, а не копируется).  */
+        T popBack()
+        {
+            [[maybe_unused]] auto timer = stats.startTimer(ListOperation::PopBack);
+
+            /* 1.   Проверяю список на пустоту. 
+                    Если список пустой - невозможно ничего удалить (выбрасываю исключение).   */
+            if (head == nullptr) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            // 2. Ищу предпоследний узел (если в списке только один узел - его нет).
+            ListNode<T>* previous = nullptr;
+            size_t visited = 1;
+
+            if (head != tail)
+            {
+                previous = head;
+
+                while (previous->next != tail)
+                {
+                    previous = previous->next;
+                    ++visited;
+                }
+            }
+
+            stats.onTraverse(ListOperation::PopBack, visited);
+
+            // 3. Перемещаю значение из последнего узла (T не обязан иметь конструктор по умолчанию).
+            T deleted = std::move(tail->value);
+
+            // 3.1. Если курсор стоит на удаляемом узле - сбрасываю его.
+            if (cursorNode == tail) {
+                resetCursor();
+            }
+
+            // 4. Удаляю последний узел.
+            destroyNode(tail);
+
+            // 5. Обновляю указатели: предпоследний узел становится хвостом (или список становится пустым).
+            tail = previous;
+
+            if (previous == nullptr) {
+                head = nullptr;
+            }
+            else {
+                previous->next = nullptr;
+            }
+        
+            --sizeOfList;
+        
+            return deleted;
+        }
+    };
+
+    /*  SmallLinkedList - список, первые N узлов которого хранятся в самом объекте
+        (для множества коротких списков: пока длина не больше N, память не выделяется).  */
+    template <typename T, size_t N, typename Allocator = std::allocator<T>>
+    using SmallLinkedList = LinkedList<T, Allocator, NoStats, N>;
+
+    /*  parallel - параллельные алгоритмы над LinkedList.
+        1.  Первый аргумент - исполнитель: execution::seq (последовательно в вызывающем потоке),
+        execution::par (общий пул WorkStealingPool::instance()) или конкретный WorkStealingPool.
+        2.  Список разбивается на отрезки почти равной длины одним предварительным проходом по цепочке
+        (запоминается начало каждого отрезка), и отрезки обрабатываются задачами пула. Отрезков в несколько раз
+        больше, чем потоков, чтобы потоки с быстрыми отрезками перехватывали работу у медленных.
+        3.  Предварительный проход стоит столько же, сколько один последовательный обход, поэтому
+        распараллеливание окупается, когда обработка элемента заметно дороже перехода по указателю.
+        4.  Функции пользователя вызываются одновременно из нескольких потоков для разных элементов
+        и должны это допускать. Исключение из функции пользователя выбрасывается из алгоритма
+        (часть элементов к этому моменту может быть уже обработана).  */
+    namespace parallel
+    {
+        // Минимальная длина отрезка (более короткие отрезки не окупают задачу пула).
+        inline constexpr size_t minSegmentLength = 1024;
+
+        // Количество отрезков на один поток пула (запас для балансировки перехватом задач).
+        inline constexpr size_t segmentsPerThread = 4;
+
+        // Признак того, что тип является исполнителем для параллельных алгоритмов.
+        template <typename Executor>
+        inline constexpr bool is_executor_v =
+            execution::is_execution_policy_v<Executor> || std::is_same_v<std::decay_t<Executor>, WorkStealingPool>;
+
+        // Метод возвращает пул исполнителя (nullptr - последовательное выполнение).
+        inline WorkStealingPool* poolOf(execution::sequenced_policy) {
+            return nullptr;
+        }
+
+        inline WorkStealingPool* poolOf(execution::parallel_policy) {
+            return &WorkStealingPool::instance();
+        }
+
+        inline WorkStealingPool* poolOf(WorkStealingPool& pool) {
+            return &pool;
+        }
+
+        // Segment - отрезок списка [first, last), offset - номер первого элемента отрезка в списке.
+        template <typename Iterator>
+        struct Segment
+        {
+            Iterator first;
+            Iterator last;
+            size_t offset;
+        };
+
+        /*  Метод разбивает список на отрезки почти равной длины (один проход по цепочке)
+            и выполняет process(segment, number) для каждого отрезка на потоках пула pool.
+            Возвращает количество отрезков (их номера - от 0 в порядке следования по списку).  */
+        template <typename List, typename Process>
+        size_t forEachSegment(WorkStealingPool* pool, List& list, Process process)
+        {
+            using Iterator = decltype(list.begin());
+
+            const size_t length = list.size();
+            size_t segmentCount = 1;
+
+            if (pool != nullptr && pool->concurrency() > 1) {
+                segmentCount = std::max<size_t>(1, std::min(pool->concurrency() * segmentsPerThread, length / minSegmentLength));
+            }
+
+            // 1. Один отрезок обрабатываю сразу, без пула.
+            if (segmentCount == 1)
+            {
+                process(Segment<Iterator>{list.begin(), list.end(), 0}, size_t(0));
+                return 1;
+            }
+
+            // 2. Запоминаю начало каждого отрезка.
+            std::vector<Segment<Iterator>> segments;
+            segments.reserve(segmentCount);
+
+            Iterator current = list.begin();
+            size_t offset = 0;
+
+            for (size_t segment = 0; segment < segmentCount; ++segment)
+            {
+                const size_t segmentLength = length / segmentCount + (segment < length % segmentCount);
+                segments.push_back(Segment<Iterator>{current, list.end(), offset});
+
+                if (segment > 0) {
+                    segments[segment - 1].last = current;
+                }
+
+                for (size_t i = 0; i < segmentLength; ++i) {
+                    ++current;
+                }
+
+                offset += segmentLength;
+            }
+
+            // 3. Обрабатываю отрезки на потоках пула.
+            pool->parallelFor(segmentCount, [&](size_t segment) {
+                process(segments[segment], segment);
+            });
+
+            return segmentCount;
+        }
+
+        // Метод вызывает function(value) для каждого элемента списка.
+        template <typename Executor, typename T, typename Allocator, typename Stats, size_t N, typename Function,
+                  typename = std::enable_if_t<is_executor_v<Executor>>>
+        void forEach(Executor&& executor, LinkedList<T, Allocator, Stats, N>& list, Function function)
+        {
+            forEachSegment(poolOf(executor), list, [&function](const auto& segment, size_t) {
+                for (auto current = segment.first; current != segment.last; ++current) {
+                    function(*current);
+                }
+            });
+        }
+
+        // Метод заменяет каждый элемент списка результатом operation(value).
+        template <typename Executor, typename T, typename Allocator, typename Stats, size_t N, typename Operation,
+                  typename = std::enable_if_t<is_executor_v<Executor>>>
+        void transform(Executor&& executor, LinkedList<T, Allocator, Stats, N>& list, Operation operation)
+        {
+            forEachSegment(poolOf(executor), list, [&operation](const auto& segment, size_t) {
+                for (auto current = segment.first; current != segment.last; ++current) {
+                    *current = operation(std::as_const(*current));
+                }
+            });
+        }
+
+        /*  Метод сворачивает элементы списка операцией operation, начиная с init.
+            Отрезки сворачиваются независимо, а их результаты - по порядку, поэтому operation
+            должна быть ассоциативной (коммутативность не требуется).  */
+        template <typename Executor, typename T, typename Allocator, typename Stats, size_t N, typename Result,
+                  typename Operation = std::plus<>, typename = std::enable_if_t<is_executor_v<Executor>>>
+        Result reduce(Executor&& executor, const LinkedList<T, Allocator, Stats, N>& list, Result init,
+                      Operation operation = Operation())
+        {
+            if (list.isEmpty()) {
+                return init;
+            }
+
+            std::vector<std::optional<Result>> partials(std::max<size_t>(1, list.size() / minSegmentLength));
+
+            const size_t segmentCount = forEachSegment(poolOf(executor), list, [&](const auto& segment, size_t number) {
+                auto current = segment.first;
+                Result partial = Result(*current);
+
+                for (++current; current != segment.last; ++current) {
+                    partial = operation(std::move(partial), *current);
+                }
+
+                partials[number].emplace(std::move(partial));
+            });
+
+            for (size_t segment = 0; segment < segmentCount; ++segment) {
+                init = operation(std::move(init), std::move(*partials[segment]));
+            }
+
+            return init;
+        }
+
+        // Метод возвращает количество элементов, удовлетворяющих предикату predicate.
+        template <typename Executor, typename T, typename Allocator, typename Stats, size_t N, typename Predicate,
+                  typename = std::enable_if_t<is_executor_v<Executor>>>
+        size_t countIf(Executor&& executor, const LinkedList<T, Allocator, Stats, N>& list, Predicate predicate)
+        {
+            std::atomic<size_t> total{0};
+
+            forEachSegment(poolOf(executor), list, [&](const auto& segment, size_t) {
+                size_t counted = 0;
+
+                for (auto current = segment.first; current != segment.last; ++current) {
+                    counted += predicate(*current) ? 1 : 0;
+                }
+
+                total.fetch_add(counted, std::memory_order_relaxed);
+            });
+
+            return total.load(std::memory_order_relaxed);
+        }
+
+        /*  Метод ищет первый (в порядке следования) элемент, удовлетворяющий предикату predicate,
+            и возвращает указатель на него. Если такого элемента нет - возвращает nullptr.
+            Как только в каком-то отрезке найден элемент, отрезки дальше него прекращают поиск.  */
+        template <typename Executor, typename T, typename Allocator, typename Stats, size_t N, typename Predicate,
+                  typename = std::enable_if_t<is_executor_v<Executor>>>
+        T* findIf(Executor&& executor, const LinkedList<T, Allocator, Stats, N>& list, Predicate predicate)
+        {
+            // Номер первого отрезка, в котором найден элемент, и найденные элементы по отрезкам.
+            std::atomic<size_t> firstFound{std::numeric_limits<size_t>::max()};
+            std::vector<T*> found(std::max<size_t>(1, list.size() / minSegmentLength), nullptr);
+
+            forEachSegment(poolOf(executor), list, [&](const auto& segment, size_t number) {
+                for (auto current = segment.first; current != segment.last; ++current)
+                {
+                    // Результат более раннего отрезка важнее любого найденного здесь.
+                    if (firstFound.load(std::memory_order_relaxed) < number) {
+                        return;
+                    }
+
+                    if (predicate(*current))
+                    {
+                        // Как и LinkedList::find(), метод возвращает указатель на изменяемый элемент.
+                        found[number] = const_cast<T*>(&*current);
+
+                        size_t expected = firstFound.load(std::memory_order_relaxed);
+
+                        while (number < expected && !firstFound.compare_exchange_weak(expected, number)) {}
+
+                        return;
+                    }
+                }
+            });
+
+            const size_t number = firstFound.load(std::memory_order_acquire);
+            return number < found.size() ? found[number] : nullptr;
+        }
+
+        /*  Метод удаляет все элементы, удовлетворяющие предикату predicate, и возвращает их количество.
+            Предикат вычисляется параллельно, а узлы удаляются одним последовательным проходом (LinkedList::removeIf).  */
+        template <typename Executor, typename T, typename Allocator, typename Stats, size_t N, typename Predicate,
+                  typename = std::enable_if_t<is_executor_v<Executor>>>
+        size_t removeIf(Executor&& executor, LinkedList<T, Allocator, Stats, N>& list, Predicate predicate)
+        {
+            // 1. Отмечаю удаляемые элементы (по байту на элемент: биты std::vector<bool> нельзя писать из разных потоков).
+            std::vector<unsigned char> marks(list.size());
+
+            forEachSegment(poolOf(executor), list, [&](const auto& segment, size_t) {
+                size_t index = segment.offset;
+
+                for (auto current = segment.first; current != segment.last; ++current, ++index) {
+                    marks[index] = predicate(std::as_const(*current)) ? 1 : 0;
+                }
+            });
+
+            // 2. Удаляю отмеченные узлы (removeIf проходит список по порядку ровно один раз).
+            size_t index = 0;
+
+            return list.removeIf([&marks, &index](const T&) {
+                return marks[index++] != 0;
+            });
+        }
+    }
+
+    /*  views - ленивые представления диапазонов (LinkedList и других контейнеров с begin() / end()).
+        1.  Представление не копирует элементы: оно хранит ссылку на исходный диапазон (или сам диапазон,
+        если он передан как временный объект) и вычисляет элементы по мере обхода.
+        2.  Представления соединяются в цепочки оператором |, например
+        list | views::filter(isEven) | views::transform(square) | views::take(10).
+        3.  Их итераторы - однонаправленные, поэтому представления можно передавать в стандартные алгоритмы
+        и в std::ranges. Важно! Исходный диапазон должен жить дольше представления.  */
+    namespace views
+    {
+        // RefView - представление всего диапазона-lvalue (хранит указатель на диапазон).
+        template <typename Range>
+        class RefView
+        {
+        private:
+            Range* range;
+
+        public:
+            RefView() : range(nullptr) {}
+
+            RefView(Range& range) : range(std::addressof(range)) {}
+
+            auto begin() const {
+                return range->begin();
+            }
+
+            auto end() const {
+                return range->end();
+            }
+        };
+
+        // Метод возвращает представление диапазона range: для lvalue - RefView, временный диапазон перемещается в результат.
+        template <typename Range>
+        auto all(Range&& range)
+        {
+            if constexpr (std::is_lvalue_reference_v<Range>) {
+                return RefView<std::remove_reference_t<Range>>(range);
+            }
+            else {
+                return std::decay_t<Range>(std::forward<Range>(range));
+            }
+        }
+
+        template <typename Range>
+        using AllView = decltype(all(std::declval<Range>()));
+
+        // Тип итератора представления View.
+        template <typename View>
+        using IteratorOf = decltype(std::declval<const View&>().begin());
+
+        /*  Категория итератора, разыменование которого дает Reference: итератор, возвращающий значение
+            (а не ссылку), в терминах C++17 является лишь итератором ввода.  */
+        template <typename Reference>
+        using CategoryOf = std::conditional_t<std::is_lvalue_reference_v<Reference>,
+                                              std::forward_iterator_tag, std::input_iterator_tag>;
+
+        // FilterView - элементы View, удовлетворяющие предикату Predicate.
+        template <typename View, typename Predicate>
+        class FilterView
+        {
+        private:
+            View base;
+            Predicate predicate;
+
+        public:
+            class Iterator
+            {
+            private:
+                using BaseIterator = IteratorOf<View>;
+
+                BaseIterator current;
+                BaseIterator last;
+                const Predicate* predicate;
+
+                // Метод передвигает итератор на ближайший подходящий элемент.
+                void skip()
+                {
+                    while (current != last && !(*predicate)(*current)) {
+                        ++current;
+                    }
+                }
+
+            public:
+                using iterator_category = typename std::iterator_traits<BaseIterator>::iterator_category;
+                using iterator_concept = std::forward_iterator_tag;
+                using value_type = typename std::iterator_traits<BaseIterator>::value_type;
+                using difference_type = std::ptrdiff_t;
+                using pointer = typename std::iterator_traits<BaseIterator>::pointer;
+                using reference = typename std::iterator_traits<BaseIterator>::reference;
+
+                Iterator() : current(), last(), predicate(nullptr) {}
+
+                Iterator(BaseIterator current, BaseIterator last, const Predicate* predicate)
+                : current(current), last(last), predicate(predicate)
+                {
+                    skip();
+                }
+
+                reference operator*() const {
+                    return *current;
+                }
+
+                Iterator& operator++()
+                {
+                    ++current;
+                    skip();
+                    return *this;
+                }
+
+                Iterator operator++(int)
+                {
+                    Iterator previous = *this;
+                    ++*this;
+                    return previous;
+                }
+
+                bool operator==(const Iterator& other) const {
+                    return current == other.current;
+                }
+
+                bool operator!=(const Iterator& other) const {
+                    return current != other.current;
+                }
+            };
+
+            FilterView(View base, Predicate predicate) : base(std::move(base)), predicate(std::move(predicate)) {}
+
+            // Метод возвращает итератор на первый подходящий элемент (поиск выполняется при каждом вызове).
+            Iterator begin() const {
+                return Iterator(base.begin(), base.end(), &predicate);
+            }
+
+            Iterator end() const {
+                return Iterator(base.end(), base.end(), &predicate);
+            }
+        };
+
+        // TransformView - результаты function(value) для элементов View.
+        template <typename View, typename Function>
+        class TransformView
+        {
+        private:
+            View base;
+            Function function;
+
+        public:
+            class Iterator
+            {
+            private:
+                using BaseIterator = IteratorOf<View>;
+
+                BaseIterator current;
+                const Function* function;
+
+            public:
+                using reference = std::invoke_result_t<const Function&, typename std::iterator_traits<BaseIterator>::reference>;
+                using iterator_category = CategoryOf<reference>;
+                using iterator_concept = std::forward_iterator_tag;
+                using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
+                using difference_type = std::ptrdiff_t;
+                using pointer = void;
+
+                Iterator() : current(), function(nullptr) {}
+
+                Iterator(BaseIterator current, const Function* function) : current(current), function(function) {}
+
+                reference operator*() const {
+                    return (*function)(*current);
+                }
+
+                Iterator& operator++()
+                {
+                    ++current;
+                    return *this;
+                }
+
+                Iterator operator++(int)
+                {
+                    Iterator previous = *this;
+                    ++current;
+                    return previous;
+                }
+
+                bool operator==(const Iterator& other) const {
+                    return current == other.current;
+                }
+
+                bool operator!=(const Iterator& other) const {
+                    return current != other.current;
+                }
+            };
+
+            TransformView(View base, Function function) : base(std::move(base)), function(std::move(function)) {}
+
+            Iterator begin() const {
+                return Iterator(base.begin(), &function);
+            }
+
+            Iterator end() const {
+                return Iterator(base.end(), &function);
+            }
+        };
+
+        // TakeView - первые count элементов View (или все, если их меньше).
+        template <typename View>
+        class TakeView
+        {
+        private:
+            View base;
+            size_t count;
+
+        public:
+            class Iterator
+            {
+            private:
+                using BaseIterator = IteratorOf<View>;
+
+                BaseIterator current;
+                BaseIterator last;
+                size_t remaining;
+
+                bool atEnd() const {
+                    return remaining == 0 || current == last;
+                }
+
+            public:
+                using iterator_category = typename std::iterator_traits<BaseIterator>::iterator_category;
+                using iterator_concept = std::forward_iterator_tag;
+                using value_type = typename std::iterator_traits<BaseIterator>::value_type;
+                using difference_type = std::ptrdiff_t;
+                using pointer = typename std::iterator_traits<BaseIterator>::pointer;
+                using reference = typename std::iterator_traits<BaseIterator>::reference;
+
+                Iterator() : current(), last(), remaining(0) {}
+
+                Iterator(BaseIterator current, BaseIterator last, size_t remaining)
+                : current(current), last(last), remaining(remaining) {}
+
+                reference operator*() const {
+                    return *current;
+                }
+
+                // Исходный итератор не сдвигается за последний взятый элемент (исходный диапазон может быть бесконечным).
+                Iterator& operator++()
+                {
+                    if (--remaining != 0) {
+                        ++current;
+                    }
+
+                    return *this;
+                }
+
+                Iterator operator++(int)
+                {
+                    Iterator previous = *this;
+                    ++*this;
+                    return previous;
+                }
+
+                // Все итераторы, дошедшие до конца (по счетчику или по исходному диапазону), равны.
+                bool operator==(const Iterator& other) const {
+                    return atEnd() || other.atEnd() ? atEnd() && other.atEnd() : current == other.current;
+                }
+
+                bool operator!=(const Iterator& other) const {
+                    return !(*this == other);
+                }
+            };
+
+            TakeView(View base, size_t count) : base(std::move(base)), count(count) {}
+
+            Iterator begin() const {
+                return Iterator(base.begin(), base.end(), count);
+            }
+
+            Iterator end() const {
+                return Iterator(base.end(), base.end(), 0);
+            }
+        };
+
+        // DropView - элементы View без первых count.
+        template <typename View>
+        class DropView
+        {
+        private:
+            View base;
+            size_t count;
+
+        public:
+            DropView(View base, size_t count) : base(std::move(base)), count(count) {}
+
+            // Метод пропускает первые count элементов (за O(count) при каждом вызове).
+            IteratorOf<View> begin() const
+            {
+                IteratorOf<View> current = base.begin();
+                const IteratorOf<View> last = base.end();
+
+                for (size_t i = 0; i < count && current != last; ++i) {
+                    ++current;
+                }
+
+                return current;
+            }
+
+            IteratorOf<View> end() const {
+                return base.end();
+            }
+        };
+
+        // Chunk - отрезок [first, last) исходного диапазона (сам является диапазоном).
+        template <typename BaseIterator>
+        class Chunk
+        {
+        private:
+            BaseIterator first;
+            BaseIterator last;
+
+        public:
+            Chunk() = default;
+
+            Chunk(BaseIterator first, BaseIterator last) : first(first), last(last) {}
+
+            BaseIterator begin() const {
+                return first;
+            }
+
+            BaseIterator end() const {
+                return last;
+            }
+        };
+
+        // ChunkView - элементы View, сгруппированные в отрезки по size элементов (последний отрезок может быть короче).
+        template <typename View>
+        class ChunkView
+        {
+        private:
+            View base;
+            size_t size;
+
+        public:
+            class Iterator
+            {
+            private:
+                using BaseIterator = IteratorOf<View>;
+
+                // Начало текущего отрезка, начало следующего и конец исходного диапазона.
+                BaseIterator current;
+                BaseIterator next;
+                BaseIterator last;
+                size_t size;
+
+                // Метод находит начало отрезка, следующего за текущим.
+                void findNext()
+                {
+                    next = current;
+
+                    for (size_t i = 0; i < size && next != last; ++i) {
+                        ++next;
+                    }
+                }
+
+            public:
+                using iterator_category = std::input_iterator_tag;
+                using iterator_concept = std::forward_iterator_tag;
+                using value_type = Chunk<BaseIterator>;
+                using difference_type = std::ptrdiff_t;
+                using pointer = void;
+                using reference = Chunk<BaseIterator>;
+
+                Iterator() : current(), next(), last(), size(0) {}
+
+                Iterator(BaseIterator current, BaseIterator last, size_t size)
+                : current(current), next(current), last(last), size(size)
+                {
+                    findNext();
+                }
+
+                reference operator*() const {
+                    return Chunk<BaseIterator>(current, next);
+                }
+
+                Iterator& operator++()
+                {
+                    current = next;
+                    findNext();
+                    return *this;
+                }
+
+                Iterator operator++(int)
+                {
+                    Iterator previous = *this;
+                    ++*this;
+                    return previous;
+                }
+
+                bool operator==(const Iterator& other) const {
+                    return current == other.current;
+                }
+
+                bool operator!=(const Iterator& other) const {
+                    return current != other.current;
+                }
+            };
+
+            // Если size == 0 - выбрасывает исключение.
+            ChunkView(View base, size_t size) : base(std::move(base)), size(size)
+            {
+                if (size == 0) {
+                    throw std::invalid_argument("Error! The chunk size must be positive.");
+                }
+            }
+
+            Iterator begin() const {
+                return Iterator(base.begin(), base.end(), size);
+            }
+
+            Iterator end() const {
+                return Iterator(base.end(), base.end(), size);
+            }
+        };
+
+        /*  Adaptor - заготовка представления без исходного диапазона (например, views::take(10)).
+            Оператор range | adaptor создает представление над range.  */
+        template <typename Make>
+        struct Adaptor
+        {
+            Make make;
+
+            template <typename Range>
+            friend auto operator|(Range&& range, const Adaptor& adaptor) {
+                return adaptor.make(all(std::forward<Range>(range)));
+            }
+        };
+
+        template <typename Make>
+        Adaptor<Make> makeAdaptor(Make make) {
+            return Adaptor<Make>{std::move(make)};
+        }
+
+        // Методы создают представления над range (или заготовки для оператора |, если range не указан).
+        template <typename Range, typename Predicate>
+        auto filter(Range&& range, Predicate predicate) {
+            return FilterView<AllView<Range>, Predicate>(all(std::forward<Range>(range)), std::move(predicate));
+        }
+
+        template <typename Predicate>
+        auto filter(Predicate predicate)
+        {
+            return makeAdaptor([predicate](auto view) {
+                return FilterView<decltype(view), Predicate>(std::move(view), predicate);
+            });
+        }
+
+        template <typename Range, typename Function>
+        auto transform(Range&& range, Function function) {
+            return TransformView<AllView<Range>, Function>(all(std::forward<Range>(range)), std::move(function));
+        }
+
+        template <typename Function>
+        auto transform(Function function)
+        {
+            return makeAdaptor([function](auto view) {
+                return TransformView<decltype(view), Function>(std::move(view), function);
+            });
+        }
+
+        template <typename Range>
+        auto take(Range&& range, size_t count) {
+            return TakeView<AllView<Range>>(all(std::forward<Range>(range)), count);
+        }
+
+        inline auto take(size_t count)
+        {
+            return makeAdaptor([count](auto view) {
+                return TakeView<decltype(view)>(std::move(view), count);
+            });
+        }
+
+        template <typename Range>
+        auto drop(Range&& range, size_t count) {
+            return DropView<AllView<Range>>(all(std::forward<Range>(range)), count);
+        }
+
+        inline auto drop(size_t count)
+        {
+            return makeAdaptor([count](auto view) {
+                return DropView<decltype(view)>(std::move(view), count);
+            });
+        }
+
+        template <typename Range>
+        auto chunk(Range&& range, size_t size) {
+            return ChunkView<AllView<Range>>(all(std::forward<Range>(range)), size);
+        }
+
+        inline auto chunk(size_t size)
+        {
+            return makeAdaptor([size](auto view) {
+                return ChunkView<decltype(view)>(std::move(view), size);
+            });
+        }
+
+#ifdef CONTAINERS_HAS_COROUTINES
+        /*  Generator - генератор на сопрограммах C++20: значения вычисляются по одному по запросу потребителя.
+            1.  Значения можно забирать методом next() (возвращает false, когда значения закончились) и value()
+            или обходить циклом for (обходить генератор можно только один раз).
+            2.  Исключение, выброшенное внутри генератора, выбрасывается из next() (или из ++ итератора).  */
+        template <typename T>
+        class Generator
+        {
+        public:
+            struct promise_type
+            {
+                // Последнее выданное значение (живет, пока сопрограмма приостановлена на co_yield).
+                const T* current = nullptr;
+                std::exception_ptr error;
+
+                Generator get_return_object() {
+                    return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+                }
+
+                std::suspend_always initial_suspend() noexcept {
+                    return {};
+                }
+
+                std::suspend_always final_suspend() noexcept {
+                    return {};
+                }
+
+                std::suspend_always yield_value(const T& value) noexcept
+                {
+                    current = std::addressof(value);
+                    return {};
+                }
+
+                void return_void() noexcept {}
+
+                void unhandled_exception() {
+                    error = std::current_exception();
+                }
+            };
+
+            class Iterator
+            {
+            private:
+                Generator* generator;
+
+            public:
+                using iterator_category = std::input_iterator_tag;
+                using value_type = T;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const T*;
+                using reference = const T&;
+
+                Iterator() : generator(nullptr) {}
+
+                explicit Iterator(Generator* generator) : generator(generator) {}
+
+                reference operator*() const {
+                    return generator->value();
+                }
+
+                Iterator& operator++()
+                {
+                    generator->next();
+                    return *this;
+                }
+
+                void operator++(int) {
+                    ++*this;
+                }
+
+                // Итератор равен концу, когда значения генератора закончились.
+                bool operator==(const Iterator& other) const {
+                    return finished() == other.finished();
+                }
+
+                bool operator!=(const Iterator& other) const {
+                    return !(*this == other);
+                }
+
+            private:
+                bool finished() const {
+                    return generator == nullptr || generator->handle.done();
+                }
+            };
+
+        private:
+            std::coroutine_handle<promise_type> handle;
+
+            explicit Generator(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+
+        public:
+            Generator(Generator&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+
+            Generator& operator=(Generator&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    if (handle) {
+                        handle.destroy();
+                    }
+
+                    handle = std::exchange(other.handle, nullptr);
+                }
+
+                return *this;
+            }
+
+            ~Generator()
+            {
+                if (handle) {
+                    handle.destroy();
+                }
+            }
+
+            // Метод вычисляет следующее значение. Возвращает false, если значения закончились.
+            bool next()
+            {
+                if (handle.done()) {
+                    return false;
+                }
+
+                handle.resume();
+
+                if (handle.promise().error) {
+                    std::rethrow_exception(std::exchange(handle.promise().error, nullptr));
+                }
+
+                return !handle.done();
+            }
+
+            // Метод возвращает последнее вычисленное значение.
+            const T& value() const {
+                return *handle.promise().current;
+            }
+
+            // Метод вычисляет первое значение и возвращает итератор на него.
+            Iterator begin()
+            {
+                next();
+                return Iterator(this);
+            }
+
+            Iterator end() {
+                return Iterator();
+            }
+        };
+
+        template <typename View>
+        Generator<std::remove_cv_t<std::remove_reference_t<decltype(*std::declval<const View&>().begin())>>> generateFrom(View view)
+        {
+            for (auto&& value : view) {
+                co_yield value;
+            }
+        }
+
+        // Метод возвращает генератор, выдающий элементы диапазона range по одному (range может быть представлением).
+        template <typename Range>
+        auto generate(Range&& range) {
+            return generateFrom(all(std::forward<Range>(range)));
+        }
+#endif
+    }
+
+#ifdef CONTAINERS_HAS_MMAP
+    /*  MappedListView - шаблонный класс, описывающий доступный только для чтения список из файла,
+        записанного LinkedList<T>::saveTo().
+        1.  Файл отображается в память, и элементы читаются прямо из него: узлы не создаются,
+        а страницы файла подгружаются системой по мере обхода. Поэтому открытие не зависит от длины списка.
+        2.  Поддерживаются только тривиально копируемые T (они хранятся в файле сплошным массивом).
+        3.  Объект нельзя копировать, но можно перемещать. Файл не должен изменяться, пока он отображен.  */
+    template <typename T>
+    class MappedListView
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "MappedListView requires a trivially copyable T.");
+        static_assert(alignof(T) <= sizeof(ListFileHeader), "MappedListView doesn't support over-aligned T.");
+
+    private:
+        // Отображенная область (весь файл) и ее длина.
+        void* mapping;
+        size_t mappingLength;
+
+        // Первый элемент списка (сразу за заголовком) и количество элементов.
+        const T* values;
+        size_t count;
+
+        // Метод снимает отображение файла.
+        void unmap() noexcept
+        {
+            if (mapping != nullptr) {
+                munmap(mapping, mappingLength);
+            }
+
+            mapping = nullptr;
+            mappingLength = 0;
+            values = nullptr;
+            count = 0;
+        }
+
+    public:
+        /*  Конструктор отображает файл path в память и проверяет заголовок.
+            При ошибке (файл не открывается, поврежден или записан для другого типа) выбрасывает исключение.  */
+        explicit MappedListView(const std::string& path) : mapping(nullptr), mappingLength(0), values(nullptr), count(0)
+        {
+            // 1. Открываю файл и узнаю его длину.
+            const int descriptor = ::open(path.c_str(), O_RDONLY);
+
+            if (descriptor < 0) {
+                throw std::runtime_error("Error! Can't open the file " + path);
+            }
+
+            struct stat status;
+
+            if (fstat(descriptor, &status) != 0 || size_t(status.st_size) < sizeof(ListFileHeader))
+            {
+                ::close(descriptor);
+                throw std::runtime_error("Error! The data is not a serialized list.");
+            }
+
+            // 2. Отображаю файл (дескриптор после этого не нужен).
+            mappingLength = size_t(status.st_size);
+            void* address = mmap(nullptr, mappingLength, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            ::close(descriptor);
+
+            if (address == MAP_FAILED)
+            {
+                mappingLength = 0;
+                throw std::runtime_error("Error! Can't map the file " + path);
+            }
+
+            mapping = address;
+
+            // 3. Проверяю заголовок и то, что все элементы помещаются в файл.
+            const ListFileHeader* header = static_cast<const ListFileHeader*>(mapping);
+
+            try
+            {
+                header->validate(elementKindOf<T>(), std::uint32_t(sizeof(T)));
+
+                if (header->count > (mappingLength - sizeof(ListFileHeader)) / sizeof(T)) {
+                    throw std::runtime_error("Error! The serialized list is truncated.");
+                }
+            }
+            catch (...)
+            {
+                unmap();
+                throw;
+            }
+
+            // 4. Элементы читаются по порядку - подсказываю системе читать файл с упреждением.
+            madvise(mapping, mappingLength, MADV_SEQUENTIAL);
+
+            values = reinterpret_cast<const T*>(static_cast<const char*>(mapping) + sizeof(ListFileHeader));
+            count = size_t(header->count);
+        }
+
+        MappedListView(const MappedListView&) = delete;
+        MappedListView& operator=(const MappedListView&) = delete;
+
+        MappedListView(MappedListView&& other) noexcept
+        : mapping(other.mapping), mappingLength(other.mappingLength), values(other.values), count(other.count)
+        {
+            other.mapping = nullptr;
+            other.unmap();
+        }
+
+        MappedListView& operator=(MappedListView&& other) noexcept
+        {
+            if (this != &other)
+            {
+                unmap();
+                std::swap(mapping, other.mapping);
+                std::swap(mappingLength, other.mappingLength);
+                std::swap(values, other.values);
+                std::swap(count, other.count);
+            }
+
+            return *this;
+        }
+
+        ~MappedListView() {
+            unmap();
+        }
+
+        // Итераторы - указатели на элементы в отображенном файле.
+        const T* begin() const {
+            return values;
+        }
+
+        const T* end() const {
+            return values + count;
+        }
+
+        // Метод возвращает длину списка.
+        size_t size() const {
+            return count;
+        }
+
+        // Метод показывает, является ли список пустым.
+        bool isEmpty() const {
+            return count == 0;
+        }
+
+        /*  Оператор возвращает элемент по индексу (отрицательный индекс отсчитывается с конца).
+            Если индекс вне диапазона - выбрасывает исключение.  */
+        const T& operator[](int index) const
+        {
+            const long long position = index < 0 ? static_cast<long long>(count) + index : index;
+
+            if (position < 0 || position >= static_cast<long long>(count)) {
+                throw std::out_of_range("Error! The index is out of range.");
+            }
+
+            return values[position];
+        }
+
+        // Метод возвращает первый элемент списка. Если список пуст - выбрасывает исключение.
+        const T& front() const
+        {
+            if (count == 0) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the first element.");
+            }
+
+            return values[0];
+        }
+
+        // Метод возвращает последний элемент списка. Если список пуст - выбрасывает исключение.
+        const T& back() const
+        {
+            if (count == 0) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the last element.");
+            }
+
+            return values[count - 1];
+        }
+    };
+#endif
+
+    /*  UnrolledLinkedList - шаблонный класс, описывающий развернутый (unrolled) однонаправленный список.
+        1.  Каждый узел хранит не одно значение, а массив из нескольких значений, подобранный так,
+        чтобы узел занимал NodeBytes байт (по умолчанию - две кэш-линии).
+        2.  Для небольших T это многократно уменьшает число выделений памяти и накладные расходы
+        на указатели, а обход списка большую часть времени идет по непрерывной памяти.
+        3.  Основной интерфейс совпадает с интерфейсом LinkedList (push / emplace / pop с обоих концов, find, contains,
+        remove, removeAll, sort, operator[], front, back, clear, Iterator и ConstIterator, cbegin / cend).
+        Нет параллельной сортировки, insertAt / eraseAt, removeIf / eraseAfter, переноса узлов (append, prepend,
+        spliceAfter, splitAt, merge), compact(), saveTo() / loadFrom() и статистики.
+        4.  Для числовых T поиск внутри узла (find, contains, count, remove, removeAll) выполняется
+        векторными ядрами simd: значения узла сравниваются по 16 или 32 байта за инструкцию.
+        5.  Важно! Указатели на элементы и итераторы становятся недействительными после remove() и removeAll(),
+        так как элементы внутри узла сдвигаются.  */
+    template <typename T, typename Allocator = std::allocator<T>, size_t NodeBytes = 128>
+    class UnrolledLinkedList
+    {
+    public:
+        // Количество элементов, которое помещается в один узел (как минимум один).
+        static constexpr size_t nodeCapacity =
+            (NodeBytes > 2 * sizeof(void*) + sizeof(T)) ? (NodeBytes - 2 * sizeof(void*)) / sizeof(T) : 1;
+
+    private:
+        /*  UnrolledNode - cтруктура узла.
+            Занятые ячейки узла образуют непрерывный отрезок [first, last), что позволяет
+            добавлять элементы как в конец узла (pushBack), так и в его начало (pushFront) за O(1).  */
+        struct UnrolledNode
+        {
+            // Указатель на следующий узел списка.
+            UnrolledNode* next;
+
+            // Границы занятых ячеек узла.
+            unsigned first;
+            unsigned last;
+
+            // Память под значения (значения конструируются в ней по месту).
+            alignas(T) unsigned char storage[nodeCapacity * sizeof(T)];
+
+            UnrolledNode(unsigned position) : next(nullptr), first(position), last(position) {}
+
+            // Метод возвращает ссылку на значение в ячейке index.
+            T& at(unsigned index) {
+                return *std::launder(reinterpret_cast<T*>(storage) + index);
+            }
+
+            // Метод возвращает количество значений в узле.
+            unsigned count() const {
+                return last - first;
+            }
+
+            // Метод возвращает указатель на первое значение узла (значения узла лежат подряд).
+            T* values() {
+                return &at(first);
+            }
+        };
+
+        // Размер списка на текущий момент.
+        size_t sizeOfList;
+
+        // Указатель на первый узел списка.
+        UnrolledNode* head;
+
+        // Указатель на последний узел списка.
+        UnrolledNode* tail;
+
+        // Аллокатор узлов (аллокатор Allocator, перепривязанный к типу UnrolledNode).
+        using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<UnrolledNode>;
+        using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+        [[no_unique_address]] NodeAllocator allocator;
+
+        // Метод выделяет пустой узел, первая занятая ячейка которого будет иметь номер position.
+        UnrolledNode* createNode(unsigned position)
+        {
+            UnrolledNode* node = NodeTraits::allocate(allocator, 1);
+            ::new (static_cast<void*>(node)) UnrolledNode(position);
+            return node;
+        }
+
+        // Метод разрушает все значения узла и возвращает его память аллокатору.
+        void destroyNode(UnrolledNode* node)
+        {
+            for (unsigned i = node->first; i < node->last; ++i) {
+                node->at(i).~T();
+            }
+
+            node->~UnrolledNode();
+            NodeTraits::deallocate(allocator, node, 1);
+        }
+
+        // Метод исключает узел node из списка (previous - предыдущий узел или nullptr) и освобождает его.
+        void unlinkNode(UnrolledNode* previous, UnrolledNode* node)
+        {
+            if (previous == nullptr) {
+                head = node->next;
+            }
+            else {
+                previous->next = node->next;
+            }
+
+            if (tail == node) {
+                tail = previous;
+            }
+
+            destroyNode(node);
+        }
+
+        /*  Метод конструирует значение в ячейке index узла node.
+            Если конструктор выбросил исключение, а узел был только что создан (пуст) - узел исключается из списка,
+            чтобы в списке не оставалось пустых узлов.  */
+        template <typename... Args>
+        void constructOrUnlink(UnrolledNode* node, unsigned index, Args&&... args)
+        {
+            try {
+                ::new (static_cast<void*>(&node->at(index))) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                if (node->first == node->last)
+                {
+                    UnrolledNode* previous = nullptr;
+
+                    if (node != head)
+                    {
+                        previous = head;
+
+                        while (previous->next != node) {
+                            previous = previous->next;
+                        }
+                    }
+
+                    unlinkNode(previous, node);
+                }
+
+                throw;
+            }
+        }
+
+        // Метод переносит значения узла в начало его памяти (ячейки [0, count())).
+        static void compactNode(UnrolledNode* node) noexcept
+        {
+            const unsigned count = node->count();
+
+            // Ячейки перед first свободны, поэтому значение всегда переносится в неинициализированную ячейку.
+            for (unsigned i = 0; i < count; ++i)
+            {
+                ::new (static_cast<void*>(&node->at(i))) T(std::move(node->at(node->first + i)));
+                node->at(node->first + i).~T();
+            }
+
+            node->first = 0;
+            node->last = count;
+        }
+
+        /*  Метод восстанавливает заполненность узла node, если в нем осталось меньше половины ячеек:
+            1.  Если значения node и следующего узла помещаются в один узел - следующий узел вливается в node.
+            2.  Иначе node забирает из начала следующего узла половину разницы их длин (так повторное
+            выравнивание понадобится не раньше, чем через четверть узла удалений).
+            Выполняется только для T, перемещение которых не выбрасывает исключений.  */
+        void rebalance(UnrolledNode* node) noexcept
+        {
+            if constexpr (std::is_nothrow_move_constructible_v<T>)
+            {
+                while (node->count() < nodeCapacity / 2 && node->next != nullptr)
+                {
+                    UnrolledNode* next = node->next;
+                    const bool merge = node->count() + next->count() <= nodeCapacity;
+                    const unsigned take = merge ? next->count() : (next->count() - node->count()) / 2;
+
+                    if (node->last + take > nodeCapacity) {
+                        compactNode(node);
+                    }
+
+                    for (unsigned i = 0; i < take; ++i)
+                    {
+                        ::new (static_cast<void*>(&node->at(node->last))) T(std::move(next->at(next->first)));
+                        next->at(next->first).~T();
+                        ++node->last;
+                        ++next->first;
+                    }
+
+                    if (!merge) {
+                        break;
+                    }
+
+                    unlinkNode(node, next);
+                }
+            }
+        }
+
+        /*  Метод удаляет значение из ячейки index узла node, сдвигая последующие значения узла влево.
+            Если узел опустел - он исключается из списка, если заполнен меньше чем наполовину - выравнивается
+            со следующим узлом (см. rebalance()).  */
+        void eraseInNode(UnrolledNode* previous, UnrolledNode* node, unsigned index)
+        {
+            for (unsigned i = index; i + 1 < node->last; ++i) {
+                node->at(i) = std::move(node->at(i + 1));
+            }
+
+            node->at(node->last - 1).~T();
+            --node->last;
+            --sizeOfList;
+
+            if (node->first == node->last) {
+                unlinkNode(previous, node);
+            }
+            else {
+                rebalance(node);
+            }
+        }
+
+    public:
+        using allocator_type = Allocator;
+
+        /*  BasicIterator - класс, описывающий структуру итератора
+            (объекта, с помощью которого можно итерироваться по списку).
+            Iterator дает доступ к элементам на запись, ConstIterator - только на чтение
+            (Iterator неявно преобразуется в ConstIterator, итераторы обоих видов можно сравнивать).  */
+        template <bool IsConst>
+        class BasicIterator
+        {
+        private:
+            template <bool> friend class BasicIterator;
+
+            // Узел, на который смотрит итератор, и номер ячейки в нем.
+            UnrolledNode* pointerToNode;
+            unsigned index;
+
+        public:
+            // Информация об итераторе для библиотеки <algorithm>:
+            using iterator_category = std::forward_iterator_tag;                 // Тип итератора.
+            using value_type = T;                                                // Тип элемента.
+            using difference_type = std::ptrdiff_t;                              // Разница между итераторами.
+            using pointer = std::conditional_t<IsConst, const T*, T*>;           // Указатель на элемент.
+            using reference = std::conditional_t<IsConst, const T&, T&>;         // Ссылка на элемент.
+
+            BasicIterator() : pointerToNode(nullptr), index(0) {}
+
+            BasicIterator(UnrolledNode* somePointer)
+            : pointerToNode(somePointer), index(somePointer != nullptr ? somePointer->first : 0) {}
+
+            // Преобразование Iterator -> ConstIterator.
+            template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+            BasicIterator(const BasicIterator<OtherConst>& other) : pointerToNode(other.pointerToNode), index(other.index) {}
+
+            // Оператор разыменования - возвращает значение ячейки (на которую смотрит итератор) по ссылке.
+            reference operator*() const {
+                return pointerToNode->at(index);
+            }
+
+            pointer operator->() const {
+                return std::addressof(pointerToNode->at(index));
+            }
+
+            // Оператор префиксного инкремента - передвигает итератор на следующую ячейку (или следующий узел).
+            BasicIterator& operator++()
+            {
+                if (++index == pointerToNode->last) {
+                    *this = BasicIterator(pointerToNode->next);
+                }
+
+                return *this;
+            }
+
+            // Оператор постфиксного инкремента - передвигает итератор и возвращает его прежнее значение.
+            BasicIterator operator++(int)
+            {
+                BasicIterator previous = *this;
+                ++*this;
+                return previous;
+            }
+
+            // Операторы сравнения - проверяют итераторы на равенство.
+            template <bool OtherConst>
+            bool operator==(const BasicIterator<OtherConst>& other) const {
+                return pointerToNode == other.pointerToNode && index == other.index;
+            }
+
+            template <bool OtherConst>
+            bool operator!=(const BasicIterator<OtherConst>& other) const {
+                return !(*this == other);
+            }
+        };
+
+        using Iterator = BasicIterator<false>;
+        using ConstIterator = BasicIterator<true>;
+
+        // Имена типов, которые ожидают стандартные алгоритмы.
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = Iterator;
+        using const_iterator = ConstIterator;
+
+        // Метод возвращает итератор, который смотрит на первый элемент списка.
+        Iterator begin() {
+            return Iterator(head);
+        }
+
+        ConstIterator begin() const {
+            return ConstIterator(head);
+        }
+
+        // Метод возвращает итератор, который смотрит на элемент, следующий за последним.
+        Iterator end() {
+            return Iterator(nullptr);
+        }
+
+        ConstIterator end() const {
+            return ConstIterator(nullptr);
+        }
+
+        // Методы возвращают итераторы только для чтения (даже для неконстантного списка).
+        ConstIterator cbegin() const {
+            return ConstIterator(head);
+        }
+
+        ConstIterator cend() const {
+            return ConstIterator(nullptr);
+        }
+
+        // Конструктор по умолчанию.
+        UnrolledLinkedList() : UnrolledLinkedList(Allocator()) {}
+
+        // Конструктор, принимающий аллокатор узлов.
+        explicit UnrolledLinkedList(const Allocator& allocator)
+        : sizeOfList(0), head(nullptr), tail(nullptr), allocator(allocator) {}
+
+        // Пользовательский конструктор.
+        UnrolledLinkedList(const std::initializer_list<T>& list, const Allocator& allocator = Allocator())
+        : UnrolledLinkedList(allocator)
+        {
+            for (const T& value: list) {
+                this->pushBack(value);
+            }
+        }
+
+        // Конструктор глубокого копирования.
+        UnrolledLinkedList(const UnrolledLinkedList& other)
+        : UnrolledLinkedList(Allocator(NodeTraits::select_on_container_copy_construction(other.allocator)))
+        {
+            for (const T& value: other) {
+                this->pushBack(value);
+            }
+        }
+
+        // Конструктор копирования перемещением (забирает узлы other, оставляя его пустым).
+        UnrolledLinkedList(UnrolledLinkedList&& other) noexcept
+        : sizeOfList(other.sizeOfList), head(other.head), tail(other.tail), allocator(std::move(other.allocator))
+        {
+            other.sizeOfList = 0;
+            other.head = nullptr;
+            other.tail = nullptr;
+        }
+
+        // Деструктор.
+        ~UnrolledLinkedList() {
+            this->clear();
+        }
+
+        // Оператор глубокого копирования.
+        UnrolledLinkedList& operator=(const UnrolledLinkedList& other)
+        {
+            if (this == &other) {
+                return *this;
+            }
+
+            this->clear();
+
+            if constexpr (NodeTraits::propagate_on_container_copy_assignment::value) {
+                allocator = other.allocator;
+            }
+
+            for (const T& value: other) {
+                this->pushBack(value);
+            }
+
+            return *this;
+        }
+
+        // Оператор присваивания перемещением.
+        UnrolledLinkedList& operator=(UnrolledLinkedList&& other)
+            noexcept(NodeTraits::propagate_on_container_move_assignment::value || NodeTraits::is_always_equal::value)
+        {
+            if (this == &other) {
+                return *this;
+            }
+
+            this->clear();
+
+            // Узлы other можно забрать, только если наш аллокатор способен их освободить.
+            if constexpr (!NodeTraits::propagate_on_container_move_assignment::value)
+            {
+                if (allocator != other.allocator)
+                {
+                    for (T& value: other) {
+                        this->pushBack(std::move(value));
+                    }
+
+                    other.clear();
+                    return *this;
+                }
+            }
+            else {
+                allocator = other.allocator;
+            }
+
+            sizeOfList = other.sizeOfList;
+            head = other.head;
+            tail = other.tail;
+
+            other.sizeOfList = 0;
+            other.head = nullptr;
+            other.tail = nullptr;
+
+            return *this;
+        }
+
+        // Метод возвращает копию аллокатора, которым пользуется список.
+        Allocator getAllocator() const {
+            return Allocator(allocator);
+        }
+
+        /*
+        1.  Данный оператор предоставляет доступ к элементам списка по индексу (аналогично массивам).
+        2.  Доступна как положительная, так и отрицательная индексация (последний элемент имеет индекс -1).
+        3.  Важно! Обращение к элементу по индексу имеет сложность O(n / nodeCapacity):
+        поиск перешагивает целые узлы.
+        */
+        T& operator[](int index)
+        {
+            if (index < -int(sizeOfList) || index >= int(sizeOfList)) {
+                throw std::out_of_range("Error! The index is out of range.");
+            }
+
+            size_t position = index < 0 ? sizeOfList + index : size_t(index);
+            UnrolledNode* tempPtr = head;
+
+            // Перешагиваю узлы целиком, пока нужный элемент не окажется в текущем узле.
+            while (position >= tempPtr->count())
+            {
+                position -= tempPtr->count();
+                tempPtr = tempPtr->next;
+            }
+
+            return tempPtr->at(tempPtr->first + unsigned(position));
+        }
+
+        /*  Метод показывает, является ли список пустым.
+            Возвращает соответствующее булевое значение.  */
+        bool isEmpty() const {
+            return head == nullptr;
+        }
+
+        // Метод возвращает длину списка на текущий момент.
+        size_t size() const {
+            return sizeOfList;
+        }
+
+        // Метод возвращает значение первого элемента списка по ссылке.
+        T& front() const
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the first element.");
+            }
+
+            return head->at(head->first);
+        }
+
+        // Метод возвращает значение последнего элемента списка по ссылке.
+        T& back() const
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the last element.");
+            }
+
+            return tail->at(tail->last - 1);
+        }
+
+        // Метод выводит значения всех элементов в порядке их расположения в списке.
+        void print() const
+        {
+            for (const T& value: *this) {
+                std::cout << value << ' ';
+            }
+
+            std::cout << '\n';
+        }
+
+        /*  Метод ищет первый элемент со значением value и возвращает указатель 
+            на этот элемент. Если элемент не найден - возвращает nullptr.  */
+        T* find(const T& value) const
+        {
+            // Ядро выбирается один раз на вызов, а не на каждый узел.
+            const simd::FindKernel<T> findIn = simd::findKernel<T>();
+
+            for (UnrolledNode* tempPtr = head; tempPtr != nullptr; tempPtr = tempPtr->next)
+            {
+                // Внутри узла значения лежат подряд, поэтому поиск идет по непрерывной памяти.
+                const size_t index = findIn(tempPtr->values(), tempPtr->count(), value);
+
+                if (index != tempPtr->count()) {
+                    return tempPtr->values() + index;
+                }
+            }
+
+            return nullptr;
+        }
+
+        /*  Метод проверяет, есть ли в списке элемент со значением value.
+            Возвращает соответствующее булевое значение.  */
+        bool contains(const T& value) const {
+            return find(value) != nullptr;
+        }
+
+        // Метод возвращает количество элементов со значением value.
+        size_t count(const T& value) const
+        {
+            const simd::CountKernel<T> countIn = simd::countKernel<T>();
+            size_t result = 0;
+
+            for (UnrolledNode* tempPtr = head; tempPtr != nullptr; tempPtr = tempPtr->next) {
+                result += countIn(tempPtr->values(), tempPtr->count(), value);
+            }
+
+            return result;
+        }
+
+        /*  Метод сортирует список по возрастанию (или в порядке, заданном компаратором compare).
+            1.  Значения переносятся во временный массив, сортируются устойчивой сортировкой за O(n log n)
+            и переносятся обратно в те же ячейки - узлы и их заполненность не меняются.
+            2.  Сортировка устойчивая: равные элементы сохраняют свой взаимный порядок.
+            3.  Важно! В отличие от LinkedList, значения перемещаются между ячейками, поэтому указатели
+            на элементы после сортировки указывают на другие значения.  */
+        template <typename Compare = std::less<>>
+        void sort(Compare compare = Compare())
+        {
+            // 1. Если в списке меньше 2-х элементов - сортировать ничего не нужно.
+            if (sizeOfList < 2) {
+                return;
+            }
+
+            // 2. Переношу значения во временный массив (память берется у аллокатора списка).
+            std::vector<T, Allocator> values(getAllocator());
+            values.reserve(sizeOfList);
+
+            for (T& value : *this) {
+                values.push_back(std::move(value));
+            }
+
+            // 3. Сортирую массив и возвращаю значения в ячейки списка (в том числе если компаратор выбросил исключение).
+            auto moveBack = [this, &values]()
+            {
+                auto source = values.begin();
+
+                for (T& value : *this) {
+                    value = std::move(*source++);
+                }
+            };
+
+            try {
+                std::stable_sort(values.begin(), values.end(), compare);
+            }
+            catch (...)
+            {
+                moveBack();
+                throw;
+            }
+
+            moveBack();
+        }
+
+        // Метод полностью очищает список.
+        void clear()
+        {
+            while (head != nullptr)
+            {
+                UnrolledNode* next = head->next;
+                destroyNode(head);
+                head = next;
+            }
+
+            tail = nullptr;
+            sizeOfList = 0;
+        }
+
+        /*  Метод удаляет первый элемент со значением valueToRemove.
+            Возвращает true, если элемент с соответствующим значением был найден и удалён, иначе - false.  */
+        bool remove(const T& valueToRemove)
+        {
+            const simd::FindKernel<T> findIn = simd::findKernel<T>();
+            UnrolledNode* previous = nullptr;
+
+            for (UnrolledNode* tempPtr = head; tempPtr != nullptr; previous = tempPtr, tempPtr = tempPtr->next)
+            {
+                const size_t index = findIn(tempPtr->values(), tempPtr->count(), valueToRemove);
+
+                if (index != tempPtr->count())
+                {
+                    eraseInNode(previous, tempPtr, tempPtr->first + unsigned(index));
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /*  Метод удаляет все элементы со значением valueToRemove за один проход.
+            Возвращает true, если хотя бы один элемент был удалён, иначе - false. */
+        bool removeAll(const T& valueToRemove)
+        {
+            const simd::FindKernel<T> findIn = simd::findKernel<T>();
+            const size_t oldSize = sizeOfList;
+            UnrolledNode* previous = nullptr;
+            UnrolledNode* tempPtr = head;
+
+            while (tempPtr != nullptr)
+            {
+                // 1. Узел без удаляемых значений пропускаю целиком (для числовых T - после векторного поиска).
+                const size_t match = findIn(tempPtr->values(), tempPtr->count(), valueToRemove);
+
+                if (match == tempPtr->count())
+                {
+                    previous = tempPtr;
+                    tempPtr = tempPtr->next;
+                    continue;
+                }
+
+                // 2. Уплотняю узел, начиная с первого совпадения: оставшиеся значения сдвигаются к началу занятого отрезка.
+                unsigned write = tempPtr->first + unsigned(match);
+
+                for (unsigned read = write + 1; read < tempPtr->last; ++read)
+                {
+                    if (tempPtr->at(read) == valueToRemove) {
+                        continue;
+                    }
+
+                    if (write != read) {
+                        tempPtr->at(write) = std::move(tempPtr->at(read));
+                    }
+
+                    ++write;
+                }
+
+                // 3. Разрушаю освободившиеся в конце узла ячейки.
+                for (unsigned i = write; i < tempPtr->last; ++i) {
+                    tempPtr->at(i).~T();
+                }
+
+                sizeOfList -= tempPtr->last - write;
+                tempPtr->last = write;
+
+                // 4. Опустевший узел исключаю из списка.
+                UnrolledNode* next = tempPtr->next;
+
+                if (tempPtr->first == tempPtr->last) {
+                    unlinkNode(previous, tempPtr);
+                }
+                else {
+                    previous = tempPtr;
+                }
+
+                tempPtr = next;
+            }
+
+            // 5. Выравниваю узлы, заполненные меньше чем наполовину.
+            if (sizeOfList != oldSize)
+            {
+                for (UnrolledNode* node = head; node != nullptr; node = node->next) {
+                    rebalance(node);
+                }
+            }
+
+            return sizeOfList != oldSize;
+        }
+
+        // Метод добавляет новый элемент в начало списка.
+        void pushFront(const T& value) {
+            emplaceFront(value);
+        }
+
+        // Метод добавляет новый элемент в начало списка, перемещая в него value.
+        void pushFront(T&& value) {
+            emplaceFront(std::move(value));
+        }
+
+        // Метод добавляет новый элемент в конец списка.
+        void pushBack(const T& value) {
+            emplaceBack(value);
+        }
+
+        // Метод добавляет новый элемент в конец списка, перемещая в него value.
+        void pushBack(T&& value) {
+            emplaceBack(std::move(value));
+        }
+
+        /*  Метод конструирует новый элемент в начале списка из аргументов args.
+            Возвращает ссылку на созданный элемент.  */
+        template <typename... Args>
+        T& emplaceFront(Args&&... args)
+        {
+            // 1. Если перед первым элементом головного узла нет свободной ячейки - создаю новый узел.
+            if (head == nullptr || head->first == 0)
+            {
+                // Новый узел заполняется справа налево, чтобы последующие pushFront() попадали в него же.
+                UnrolledNode* newNode = createNode(unsigned(nodeCapacity));
+                newNode->next = head;
+                head = newNode;
+
+                if (tail == nullptr) {
+                    tail = newNode;
+                }
+            }
+
+            // 2. Конструирую значение в свободной ячейке перед первым элементом.
+            constructOrUnlink(head, head->first - 1, std::forward<Args>(args)...);
+            --head->first;
+
+            ++sizeOfList;
+
+            return head->at(head->first);
+        }
+
+        /*  Метод конструирует новый элемент в конце списка из аргументов args.
+            Возвращает ссылку на созданный элемент.  */
+        template <typename... Args>
+        T& emplaceBack(Args&&... args)
+        {
+            // 1. Если после последнего элемента хвостового узла нет свободной ячейки - создаю новый узел.
+            if (tail == nullptr || tail->last == nodeCapacity)
+            {
+                UnrolledNode* newNode = createNode(0);
+
+                if (tail == nullptr) {
+                    head = newNode;
+                }
+                else {
+                    tail->next = newNode;
+                }
+
+                tail = newNode;
+            }
+
+            // 2. Конструирую значение в свободной ячейке после последнего элемента.
+            constructOrUnlink(tail, tail->last, std::forward<Args>(args)...);
+            ++tail->last;
+
+            ++sizeOfList;
+
+            return tail->at(tail->last - 1);
+        }
+
+        /*  Метод удаляет первый элемент из списка.
+            Возвращает значение удаленного элемента.  */
+        T popFront()
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            T deleted = std::move(head->at(head->first));
+            head->at(head->first).~T();
+            ++head->first;
+            --sizeOfList;
+
+            if (head->first == head->last) {
+                unlinkNode(nullptr, head);
+            }
+            else {
+                rebalance(head);
+            }
+
+            return deleted;
+        }
+
+        /*  Метод удаляет последний элемент из списка.
+            Возвращает значение удаленного элемента.
+            Важно! Поиск предпоследнего узла имеет сложность O(n / nodeCapacity), но выполняется
+            только тогда, когда хвостовой узел опустел.  */
+        T popBack()
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            T deleted = std::move(tail->at(tail->last - 1));
+            tail->at(tail->last - 1).~T();
+            --tail->last;
+            --sizeOfList;
+
+            if (tail->first == tail->last)
+            {
+                UnrolledNode* previous = nullptr;
+
+                if (head != tail)
+                {
+                    previous = head;
+
+                    while (previous->next != tail) {
+                        previous = previous->next;
+                    }
+                }
+
+                unlinkNode(previous, tail);
+            }
+
+            return deleted;
+        }
+    };
+
+    // LinkLayout - способ хранения связей в узлах двунаправленного списка.
+    enum class LinkLayout
+    {
+        Doubly,     // Два указателя на узел: на предыдущий и на следующий узлы.
+        Xor         // Одно слово на узел: XOR адресов предыдущего и следующего узлов.
+    };
+
+    /*  BidirectionalLinkedList - шаблонный класс, описывающий структуру двунаправленного связанного списка.
+        1.  В отличие от LinkedList, удаление с конца списка (popBack) выполняется за O(1),
+        а итератор является двунаправленным (поддерживается обратный обход через rbegin()/rend()).
+        2.  Layout задает способ хранения связей:
+            - LinkLayout::Doubly - классический двусвязный список (два указателя на узел);
+            - LinkLayout::Xor - XOR-связанный список (одно слово на узел, как у LinkedList).
+        3.  Итератор хранит пару "предыдущий узел - текущий узел", поэтому одна и та же
+        реализация обхода работает для обеих раскладок.  */
+    template <typename T, LinkLayout Layout = LinkLayout::Doubly, typename Allocator = std::allocator<T>>
+    class BidirectionalLinkedList
+    {
+    private:
+        // BidirectionalNode - cтруктура узла. Связи хранятся в соответствии с раскладкой Layout.
+        struct BidirectionalNode;
+
+        /*  DoublyLinks - связи двусвязного узла.
+            Методы принимают "соседа с другой стороны", чтобы интерфейс совпадал с XorLinks (здесь он не нужен).  */
+        struct DoublyLinks
+        {
+            // Указатели на предыдущий и следующий узлы списка.
+            BidirectionalNode* prev;
+            BidirectionalNode* next;
+
+            BidirectionalNode* forward(BidirectionalNode*) const {
+                return next;
+            }
+
+            BidirectionalNode* backward(BidirectionalNode*) const {
+                return prev;
+            }
+
+            void setNext(BidirectionalNode*, BidirectionalNode* newNext) {
+                next = newNext;
+            }
+
+            void setPrev(BidirectionalNode*, BidirectionalNode* newPrev) {
+                prev = newPrev;
+            }
+
+            void set(BidirectionalNode* newPrev, BidirectionalNode* newNext)
+            {
+                prev = newPrev;
+                next = newNext;
+            }
+        };
+
+        /*  XorLinks - связи XOR-узла.
+            Узел хранит prev ^ next, поэтому, зная одного соседа, можно вычислить другого.  */
+        struct XorLinks
+        {
+            // XOR адресов предыдущего и следующего узлов.
+            std::uintptr_t link;
+
+            static std::uintptr_t address(BidirectionalNode* node) {
+                return reinterpret_cast<std::uintptr_t>(node);
+            }
+
+            BidirectionalNode* forward(BidirectionalNode* prev) const {
+                return reinterpret_cast<BidirectionalNode*>(link ^ address(prev));
+            }
+
+            BidirectionalNode* backward(BidirectionalNode* next) const {
+                return reinterpret_cast<BidirectionalNode*>(link ^ address(next));
+            }
+
+            void setNext(BidirectionalNode* oldNext, BidirectionalNode* newNext) {
+                link ^= address(oldNext) ^ address(newNext);
+            }
+
+            void setPrev(BidirectionalNode* oldPrev, BidirectionalNode* newPrev) {
+                link ^= address(oldPrev) ^ address(newPrev);
+            }
+
+            void set(BidirectionalNode* newPrev, BidirectionalNode* newNext) {
+                link = address(newPrev) ^ address(newNext);
+            }
+        };
+
+        using Links = std::conditional_t<Layout == LinkLayout::Xor, XorLinks, DoublyLinks>;
+
+        struct BidirectionalNode
+        {
+            // Значение, хранящееся в узле.
+            T value;
+
+            // Связи с соседними узлами.
+            Links links;
+
+            template <typename... Args>
+            BidirectionalNode(std::in_place_t, Args&&... args) : value(std::forward<Args>(args)...), links() {}
+        };
+
+        // Размер списка на текущий момент.
+        size_t sizeOfList;
+
+        // Указатель на первый узел списка.
+        BidirectionalNode* head;
+
+        // Указатель на последний узел списка.
+        BidirectionalNode* tail;
+
+        // Аллокатор узлов (аллокатор Allocator, перепривязанный к типу BidirectionalNode).
+        using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<BidirectionalNode>;
+        using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+        [[no_unique_address]] NodeAllocator allocator;
+
+        // Метод выделяет память под узел через аллокатор и конструирует в нем значение из аргументов args.
+        template <typename... Args>
+        BidirectionalNode* createNode(Args&&... args)
+        {
+            BidirectionalNode* node = NodeTraits::allocate(allocator, 1);
+
+            try {
+                NodeTraits::construct(allocator, node, std::in_place, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                NodeTraits::deallocate(allocator, node, 1);
+                throw;
+            }
+
+            return node;
+        }
+
+        // Метод разрушает узел и возвращает его память аллокатору.
+        void destroyNode(BidirectionalNode* node)
+        {
+            NodeTraits::destroy(allocator, node);
+            NodeTraits::deallocate(allocator, node, 1);
+        }
+
+        // Метод исключает из списка узел node (prev и next - его соседи) и освобождает его.
+        void eraseNode(BidirectionalNode* prev, BidirectionalNode* node, BidirectionalNode* next)
+        {
+            // 1. Предыдущий узел (или голова) должен показывать на следующий узел.
+            if (prev != nullptr) {
+                prev->links.setNext(node, next);
+            }
+            else {
+                head = next;
+            }
+
+            // 2. Следующий узел (или хвост) должен показывать на предыдущий узел.
+            if (next != nullptr) {
+                next->links.setPrev(node, prev);
+            }
+            else {
+                tail = prev;
+            }
+
+            destroyNode(node);
+            --sizeOfList;
+        }
+
+    public:
+        using allocator_type = Allocator;
+
+        /*  BasicIterator - класс, описывающий структуру двунаправленного итератора.
+            1.  Итератор хранит текущий узел и предыдущий узел (для XOR-раскладки без него нельзя сделать шаг).
+            2.  Iterator дает доступ к элементам на запись, ConstIterator - только на чтение.  */
+        template <bool IsConst>
+        class BasicIterator
+        {
+        private:
+            template <bool> friend class BasicIterator;
+
+            // Узел перед текущим (nullptr для первого узла) и текущий узел (nullptr для end()).
+            BidirectionalNode* previousNode;
+            BidirectionalNode* pointerToNode;
+
+        public:
+            // Информация об итераторе для библиотеки <algorithm>:
+            using iterator_category = std::bidirectional_iterator_tag;       // Тип итератора.
+            using value_type = T;                                            // Тип элемента.
+            using difference_type = std::ptrdiff_t;                          // Разница между итераторами.
+            using pointer = std::conditional_t<IsConst, const T*, T*>;       // Указатель на элемент.
+            using reference = std::conditional_t<IsConst, const T&, T&>;     // Ссылка на элемент.
+
+            BasicIterator() : previousNode(nullptr), pointerToNode(nullptr) {}
+
+            BasicIterator(BidirectionalNode* previous, BidirectionalNode* current)
+            : previousNode(previous), pointerToNode(current) {}
+
+            // Преобразование Iterator -> ConstIterator.
+            template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+            BasicIterator(const BasicIterator<OtherConst>& other)
+            : previousNode(other.previousNode), pointerToNode(other.pointerToNode) {}
+
+            // Оператор разыменования - возвращает значение узла (на который смотрит итератор) по ссылке.
+            reference operator*() const {
+                return pointerToNode->value;
+            }
+
+            pointer operator->() const {
+                return &pointerToNode->value;
+            }
+
+            // Оператор префиксного инкремента - передвигает итератор на следующий узел списка.
+            BasicIterator& operator++()
+            {
+                BidirectionalNode* next = pointerToNode->links.forward(previousNode);
+                previousNode = pointerToNode;
+                pointerToNode = next;
+                return *this;
+            }
+
+            // Оператор префиксного декремента - передвигает итератор на предыдущий узел списка.
+            BasicIterator& operator--()
+            {
+                BidirectionalNode* previous = previousNode->links.backward(pointerToNode);
+                pointerToNode = previousNode;
+                previousNode = previous;
+                return *this;
+            }
+
+            // Операторы постфиксного инкремента и декремента.
+            BasicIterator operator++(int)
+            {
+                BasicIterator copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            BasicIterator operator--(int)
+            {
+                BasicIterator copy = *this;
+                --*this;
+                return copy;
+            }
+
+            // Операторы сравнения - проверяют итераторы на равенство.
+            template <bool OtherConst>
+            bool operator==(const BasicIterator<OtherConst>& other) const {
+                return pointerToNode == other.pointerToNode;
+            }
+
+            template <bool OtherConst>
+            bool operator!=(const BasicIterator<OtherConst>& other) const {
+                return pointerToNode != other.pointerToNode;
+            }
+        };
+
+        using Iterator = BasicIterator<false>;
+        using ConstIterator = BasicIterator<true>;
+        using ReverseIterator = std::reverse_iterator<Iterator>;
+        using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = Iterator;
+        using const_iterator = ConstIterator;
+        using reverse_iterator = ReverseIterator;
+        using const_reverse_iterator = ConstReverseIterator;
+
+        // Методы возвращают итератор, который смотрит на голову списка.
+        Iterator begin() {
+            return Iterator(nullptr, head);
+        }
+
+        ConstIterator begin() const {
+            return ConstIterator(nullptr, head);
+        }
+
+        ConstIterator cbegin() const {
+            return begin();
+        }
+
+        // Методы возвращают итератор, который смотрит на узел, следующий за хвостом (его можно декрементировать).
+        Iterator end() {
+            return Iterator(tail, nullptr);
+        }
+
+        ConstIterator end() const {
+            return ConstIterator(tail, nullptr);
+        }
+
+        ConstIterator cend() const {
+            return end();
+        }
+
+        // Методы возвращают итераторы для обхода списка в обратном порядке.
+        ReverseIterator rbegin() {
+            return ReverseIterator(end());
+        }
+
+        ConstReverseIterator rbegin() const {
+            return ConstReverseIterator(end());
+        }
+
+        ConstReverseIterator crbegin() const {
+            return rbegin();
+        }
+
+        ReverseIterator rend() {
+            return ReverseIterator(begin());
+        }
+
+        ConstReverseIterator rend() const {
+            return ConstReverseIterator(begin());
+        }
+
+        ConstReverseIterator crend() const {
+            return rend();
+        }
+
+        // Конструктор по умолчанию.
+        BidirectionalLinkedList() : BidirectionalLinkedList(Allocator()) {}
+
+        // Конструктор, принимающий аллокатор узлов.
+        explicit BidirectionalLinkedList(const Allocator& allocator)
+        : sizeOfList(0), head(nullptr), tail(nullptr), allocator(allocator) {}
+
+        // Пользовательский конструктор.
+        BidirectionalLinkedList(const std::initializer_list<T>& list, const Allocator& allocator = Allocator())
+        : BidirectionalLinkedList(allocator)
+        {
+            for (const T& value: list) {
+                this->pushBack(value);
+            }
+        }
+
+        // Конструктор глубокого копирования.
+        BidirectionalLinkedList(const BidirectionalLinkedList& other)
+        : BidirectionalLinkedList(Allocator(NodeTraits::select_on_container_copy_construction(other.allocator)))
+        {
+            for (const T& value: other) {
+                this->pushBack(value);
+            }
+        }
+
+        // Конструктор копирования перемещением (забирает узлы other, оставляя его пустым).
+        BidirectionalLinkedList(BidirectionalLinkedList&& other) noexcept
+        : sizeOfList(other.sizeOfList), head(other.head), tail(other.tail), allocator(std::move(other.allocator))
+        {
+            other.sizeOfList = 0;
+            other.head = nullptr;
+            other.tail = nullptr;
+        }
+
+        // Деструктор.
+        ~BidirectionalLinkedList() {
+            this->clear();
+        }
+
+        // Оператор глубокого копирования.
+        BidirectionalLinkedList& operator=(const BidirectionalLinkedList& other)
+        {
+            if (this == &other) {
+                return *this;
+            }
+
+            this->clear();
+
+            if constexpr (NodeTraits::propagate_on_container_copy_assignment::value) {
+                allocator = other.allocator;
+            }
+
+            for (const T& value: other) {
+                this->pushBack(value);
+            }
+
+            return *this;
+        }
+
+        // Оператор присваивания перемещением.
+        BidirectionalLinkedList& operator=(BidirectionalLinkedList&& other)
+            noexcept(NodeTraits::propagate_on_container_move_assignment::value || NodeTraits::is_always_equal::value)
+        {
+            if (this == &other) {
+                return *this;
+            }
+
+            this->clear();
+
+            // Узлы other можно забрать, только если наш аллокатор способен их освободить.
+            if constexpr (!NodeTraits::propagate_on_container_move_assignment::value)
+            {
+                if (allocator != other.allocator)
+                {
+                    for (T& value: other) {
+                        this->pushBack(std::move(value));
+                    }
+
+                    other.clear();
+                    return *this;
+                }
+            }
+            else {
+                allocator = other.allocator;
+            }
+
+            sizeOfList = other.sizeOfList;
+            head = other.head;
+            tail = other.tail;
+
+            other.sizeOfList = 0;
+            other.head = nullptr;
+            other.tail = nullptr;
+
+            return *this;
+        }
+
+        // Метод возвращает копию аллокатора, которым пользуется список.
+        Allocator getAllocator() const {
+            return Allocator(allocator);
+        }
+
+        /*
+        1.  Данный оператор предоставляет доступ к элементам списка по индексу (аналогично массивам).
+        2.  Доступна как положительная, так и отрицательная индексация (последний элемент имеет индекс -1).
+        3.  Обход начинается с того конца списка, который ближе к искомому элементу,
+        поэтому в худшем случае проходится половина списка.
+        */
+        T& operator[](int index)
+        {
+            if (index < -int(sizeOfList) || index >= int(sizeOfList)) {
+                throw std::out_of_range("Error! The index is out of range.");
+            }
+
+            const size_t position = index < 0 ? sizeOfList + index : size_t(index);
+
+            if (position < sizeOfList / 2)
+            {
+                Iterator it = begin();
+                for (size_t i = 0; i < position; ++i) {
+                    ++it;
+                }
+
+                return *it;
+            }
+
+            Iterator it = end();
+            for (size_t i = sizeOfList; i > position; --i) {
+                --it;
+            }
+
+            return *it;
+        }
+
+        /*  Метод показывает, является ли список пустым.
+            Возвращает соответствующее булевое значение.  */
+        bool isEmpty() const {
+            return head == nullptr;
+        }
+
+        // Метод возвращает длину списка на текущий момент.
+        size_t size() const {
+            return sizeOfList;
+        }
+
+        // Метод возвращает значение первого узла списка по ссылке.
+        T& front() const
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the first element.");
+            }
+
+            return head->value;
+        }
+
+        // Метод возвращает значение последнего узла списка по ссылке.
+        T& back() const
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the last element.");
+            }
+
+            return tail->value;
+        }
+
+        // Метод выводит значения всех узлов в порядке их расположения в списке.
+        void print() const
+        {
+            for (const T& value: *this) {
+                std::cout << value << ' ';
+            }
+
+            std::cout << '\n';
+        }
+
+        /*  Метод ищет первый узел со значением value и возвращает указатель 
+            на значение этого узла. Если узел не найден - возвращает nullptr.  */
+        T* find(const T& value) const
+        {
+            for (Iterator it(nullptr, head); it != Iterator(tail, nullptr); ++it)
+            {
+                if (*it == value) {
+                    return &*it;
+                }
+            }
+
+            return nullptr;
+        }
+
+        /*  Метод проверяет, есть ли в списке узел со значением value.
+            Возвращает соответствующее булевое значение.  */
+        bool contains(const T& value) const {
+            return find(value) != nullptr;
+        }
+
+        // Метод полностью очищает список.
+        void clear()
+        {
+            BidirectionalNode* previous = nullptr;
+            BidirectionalNode* current = head;
+
+            while (current != nullptr)
+            {
+                BidirectionalNode* next = current->links.forward(previous);
+                previous = current;
+                destroyNode(current);
+                current = next;
+            }
+
+            head = nullptr;
+            tail = nullptr;
+            sizeOfList = 0;
+        }
+
+        /*  Метод удаляет первый узел со значением valueToRemove.
+            Возвращает true, если узел с соответствующим значением был найден и удалён, иначе - false.  */
+        bool remove(const T& valueToRemove)
+        {
+            BidirectionalNode* previous = nullptr;
+
+            for (BidirectionalNode* current = head; current != nullptr; )
+            {
+                BidirectionalNode* next = current->links.forward(previous);
+
+                if (current->value == valueToRemove)
+                {
+                    eraseNode(previous, current, next);
+                    return true;
+                }
+
+                previous = current;
+                current = next;
+            }
+
+            return false;
+        }
+
+        /*  Метод удаляет все узлы со значением valueToRemove за один проход.
+            Возвращает true, если хотя бы один узел был удалён, иначе - false. */
+        bool removeAll(const T& valueToRemove)
+        {
+            const size_t oldSize = sizeOfList;
+            BidirectionalNode* previous = nullptr;
+
+            for (BidirectionalNode* current = head; current != nullptr; )
+            {
+                BidirectionalNode* next = current->links.forward(previous);
+
+                if (current->value == valueToRemove) {
+                    eraseNode(previous, current, next);
+                }
+                else {
+                    previous = current;
+                }
+
+                current = next;
+            }
+
+            return sizeOfList != oldSize;
+        }
+
+        // Метод добавляет новый элемент в начало списка.
+        void pushFront(const T& value) {
+            emplaceFront(value);
+        }
+
+        // Метод добавляет новый элемент в начало списка, перемещая в него value.
+        void pushFront(T&& value) {
+            emplaceFront(std::move(value));
+        }
+
+        // Метод добавляет новый элемент в конец списка.
+        void pushBack(const T& value) {
+            emplaceBack(value);
+        }
+
+        // Метод добавляет новый элемент в конец списка, перемещая в него value.
+        void pushBack(T&& value) {
+            emplaceBack(std::move(value));
+        }
+
+        /*  Метод конструирует новый элемент в начале списка из аргументов args.
+            Возвращает ссылку на созданный элемент.  */
+        template <typename... Args>
+        T& emplaceFront(Args&&... args)
+        {
+            BidirectionalNode* newNode = createNode(std::forward<Args>(args)...);
+            newNode->links.set(nullptr, head);
+
+            if (head != nullptr) {
+                head->links.setPrev(nullptr, newNode);
+            }
+            else {
+                tail = newNode;
+            }
+
+            head = newNode;
+            ++sizeOfList;
+
+            return newNode->value;
+        }
+
+        /*  Метод конструирует новый элемент в конце списка из аргументов args.
+            Возвращает ссылку на созданный элемент.  */
+        template <typename... Args>
+        T& emplaceBack(Args&&... args)
+        {
+            BidirectionalNode* newNode = createNode(std::forward<Args>(args)...);
+            newNode->links.set(tail, nullptr);
+
+            if (tail != nullptr) {
+                tail->links.setNext(nullptr, newNode);
+            }
+            else {
+                head = newNode;
+            }
+
+            tail = newNode;
+            ++sizeOfList;
+
+            return newNode->value;
+        }
+
+        /*  Метод удаляет первый элемент из списка за O(1).
+            Возвращает значение удаленного элемента.  */
+        T popFront()
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            T deleted = std::move(head->value);
+            eraseNode(nullptr, head, head->links.forward(nullptr));
+
+            return deleted;
+        }
+
+        /*  Метод удаляет последний элемент из списка за O(1).
+            Возвращает значение удаленного элемента.  */
+        T popBack()
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            T deleted = std::move(tail->value);
+            eraseNode(tail->links.backward(nullptr), tail, nullptr);
+
+            return deleted;
+        }
+    };
+
+    // DoublyLinkedList - двусвязный список (два указателя на узел).
+    template <typename T, typename Allocator = std::allocator<T>>
+    using DoublyLinkedList = BidirectionalLinkedList<T, LinkLayout::Doubly, Allocator>;
+
+    // XorLinkedList - XOR-связанный список (одно слово связей на узел).
+    template <typename T, typename Allocator = std::allocator<T>>
+    using XorLinkedList = BidirectionalLinkedList<T, LinkLayout::Xor, Allocator>;
+
+    /*  IndexedLinkedList - шаблонный класс, описывающий список с позиционным индексом (индексируемый skip-list).
+        1.  Узлы связаны в обычный однонаправленный список (нижний уровень), над которым надстроены
+        "башни" ссылок, перескакивающих через несколько узлов. Каждая ссылка хранит свою ширину -
+        число узлов нижнего уровня, через которое она перескакивает.
+        2.  Благодаря ширинам operator[], insertAt() и eraseAt() (а вместе с ними pushFront, pushBack,
+        popFront и popBack) выполняются за O(log n) в среднем.
+        3.  Высота башни каждого узла выбирается случайно (вероятность подняться на уровень выше - 1/4),
+        поэтому в среднем на узел приходится 4/3 ссылки.
+        4.  Поиск по значению (find, contains, remove, removeAll) по-прежнему идет по нижнему уровню за O(n).  */
+    template <typename T, typename Allocator = std::allocator<T>>
+    class IndexedLinkedList
+    {
+    private:
+        // Максимальное количество уровней.
+        static constexpr unsigned maxLevels = 32;
+
+        struct SkipNode;
+
+        // SkipLink - ссылка уровня башни: следующий узел уровня и ширина перескока.
+        struct SkipLink
+        {
+            SkipNode* next;
+            size_t width;
+        };
+
+        /*  SkipNode - cтруктура узла.
+            Массив ссылок башни (height штук) размещается в той же памяти сразу за узлом.  */
+        struct SkipNode
+        {
+            // Значение, хранящееся в узле.
+            T value;
+
+            // Высота башни узла.
+            unsigned height;
+
+            template <typename... Args>
+            SkipNode(unsigned height, Args&&... args) : value(std::forward<Args>(args)...), height(height) {}
+        };
+
+        // Смещение массива ссылок относительно начала узла.
+        static constexpr size_t linksOffset = (sizeof(SkipNode) + alignof(SkipLink) - 1) / alignof(SkipLink) * alignof(SkipLink);
+
+        // StorageUnit - единица выделения памяти под узлы (узел занимает целое число таких единиц).
+        static constexpr size_t unitSize = alignof(SkipNode) > alignof(SkipLink) ? alignof(SkipNode) : alignof(SkipLink);
+
+        struct alignas(unitSize) StorageUnit
+        {
+            unsigned char bytes[unitSize];
+        };
+
+        // Размер списка на текущий момент.
+        size_t sizeOfList;
+
+        // Количество используемых уровней (высота самой высокой башни).
+        unsigned levelCount;
+
+        // Ссылки заголовка списка на каждом уровне (заголовок стоит перед первым узлом, его позиция - 0).
+        SkipLink headLinks[maxLevels];
+
+        // Состояние генератора случайных высот (xorshift).
+        std::uint64_t randomState;
+
+        // Аллокатор памяти под узлы (аллокатор Allocator, перепривязанный к типу StorageUnit).
+        using UnitAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<StorageUnit>;
+        using UnitTraits = std::allocator_traits<UnitAllocator>;
+
+        [[no_unique_address]] UnitAllocator allocator;
+
+        // Метод возвращает количество единиц памяти, которое занимает узел с башней высоты height.
+        static size_t unitsFor(unsigned height) {
+            return (linksOffset + height * sizeof(SkipLink) + unitSize - 1) / unitSize;
+        }
+
+        // Метод возвращает массив ссылок башни узла node (или заголовка списка, если node == nullptr).
+        SkipLink* linksOf(SkipNode* node) {
+            return node == nullptr ? headLinks : reinterpret_cast<SkipLink*>(reinterpret_cast<unsigned char*>(node) + linksOffset);
+        }
+
+        static const SkipLink* nodeLinks(const SkipNode* node) {
+            return reinterpret_cast<const SkipLink*>(reinterpret_cast<const unsigned char*>(node) + linksOffset);
+        }
+
+        // Метод выбирает случайную высоту башни нового узла.
+        unsigned randomHeight()
+        {
+            randomState ^= randomState << 13;
+            randomState ^= randomState >> 7;
+            randomState ^= randomState << 17;
+
+            // Каждая пара битов, равная нулю, поднимает башню на уровень (вероятность 1/4).
+            unsigned height = 1;
+            std::uint64_t bits = randomState;
+
+            while (height < maxLevels && (bits & 3) == 0)
+            {
+                ++height;
+                bits >>= 2;
+            }
+
+            return height;
+        }
+
+        // Метод выделяет память под узел с башней высоты height и конструирует в нем значение из аргументов args.
+        template <typename... Args>
+        SkipNode* createNode(unsigned height, Args&&... args)
+        {
+            StorageUnit* memory = UnitTraits::allocate(allocator, unitsFor(height));
+
+            try {
+                return ::new (static_cast<void*>(memory)) SkipNode(height, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                UnitTraits::deallocate(allocator, memory, unitsFor(height));
+                throw;
+            }
+        }
+
+        // Метод разрушает узел и возвращает его память аллокатору.
+        void destroyNode(SkipNode* node)
+        {
+            const unsigned height = node->height;
+
+            node->~SkipNode();
+            UnitTraits::deallocate(allocator, reinterpret_cast<StorageUnit*>(node), unitsFor(height));
+        }
+
+        /*  Метод находит на каждом уровне последний узел, стоящий строго перед позицией position
+            (позиции отсчитываются с единицы, заголовок имеет позицию 0).
+            Результат записывается в update (узлы) и rank (их позиции).  */
+        void findPredecessors(size_t position, SkipNode** update, size_t* rank)
+        {
+            SkipNode* current = nullptr;
+            size_t currentRank = 0;
+
+            for (unsigned level = levelCount; level-- > 0; )
+            {
+                SkipLink* links = linksOf(current);
+
+                while (links[level].next != nullptr && currentRank + links[level].width < position)
+                {
+                    currentRank += links[level].width;
+                    current = links[level].next;
+                    links = linksOf(current);
+                }
+
+                update[level] = current;
+                rank[level] = currentRank;
+            }
+        }
+
+        // Метод возвращает узел с индексом index (index < sizeOfList) за O(log n).
+        SkipNode* nodeAt(size_t index) const
+        {
+            const size_t position = index + 1;
+            const SkipLink* links = headLinks;
+            SkipNode* current = nullptr;
+            size_t currentRank = 0;
+
+            for (unsigned level = levelCount; level-- > 0; )
+            {
+                while (links[level].next != nullptr && currentRank + links[level].width <= position)
+                {
+                    currentRank += links[level].width;
+                    current = links[level].next;
+                    links = nodeLinks(current);
+                }
+
+                if (currentRank == position) {
+                    break;
+                }
+            }
+
+            return current;
+        }
+
+        // Метод проверяет индекс (допустимы индексы от -size() до size() - 1) и переводит его в неотрицательный.
+        size_t normalizeIndex(int index) const
+        {
+            if (index < -int(sizeOfList) || index >= int(sizeOfList)) {
+                throw std::out_of_range("Error! The index is out of range.");
+            }
+
+            return index < 0 ? sizeOfList + index : size_t(index);
+        }
+
+        /*  Метод завершает перестройку ссылок после removeAll(): last[level] - последние оставленные узлы уровней,
+            kept - количество оставленных узлов. Опустевшие верхние уровни убираются.  */
+        void finishRelink(SkipNode* const* last, size_t kept)
+        {
+            for (unsigned level = 0; level < levelCount; ++level) {
+                linksOf(last[level])[level] = SkipLink{nullptr, 0};
+            }
+
+            sizeOfList = kept;
+
+            while (levelCount > 1 && headLinks[levelCount - 1].next == nullptr) {
+                --levelCount;
+            }
+        }
+
+        // Метод отдает все узлы other этому списку (сам список other становится пустым).
+        void stealFrom(IndexedLinkedList& other)
+        {
+            sizeOfList = other.sizeOfList;
+            levelCount = other.levelCount;
+            std::copy(other.headLinks, other.headLinks + maxLevels, headLinks);
+
+            other.sizeOfList = 0;
+            other.levelCount = 1;
+            std::fill(other.headLinks, other.headLinks + maxLevels, SkipLink{nullptr, 0});
+        }
+
+    public:
+        using allocator_type = Allocator;
+
+        /*  BasicIterator - класс, описывающий структуру итератора
+            (объекта, с помощью которого можно итерироваться по списку). Итератор идет по нижнему уровню.
+            Iterator дает доступ к элементам на запись, ConstIterator - только на чтение
+            (Iterator неявно преобразуется в ConstIterator, итераторы обоих видов можно сравнивать).  */
+        template <bool IsConst>
+        class BasicIterator
+        {
+        private:
+            template <bool> friend class BasicIterator;
+
+            // Указатель на узел, на который смотрит итератор.
+            SkipNode* pointerToNode;
+
+        public:
+            // Информация об итераторе для библиотеки <algorithm>:
+            using iterator_category = std::forward_iterator_tag;                 // Тип итератора.
+            using value_type = T;                                                // Тип элемента.
+            using difference_type = std::ptrdiff_t;                              // Разница между итераторами.
+            using pointer = std::conditional_t<IsConst, const T*, T*>;           // Указатель на элемент.
+            using reference = std::conditional_t<IsConst, const T&, T&>;         // Ссылка на элемент.
+
+            BasicIterator() : pointerToNode(nullptr) {}
+
+            BasicIterator(SkipNode* somePointer) : pointerToNode(somePointer) {}
+
+            // Преобразование Iterator -> ConstIterator.
+            template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+            BasicIterator(const BasicIterator<OtherConst>& other) : pointerToNode(other.pointerToNode) {}
+
+            // Оператор разыменования - возвращает значение узла (на который смотрит итератор) по ссылке.
+            reference operator*() const {
+                return pointerToNode->value;
+            }
+
+            pointer operator->() const {
+                return std::addressof(pointerToNode->value);
+            }
+
+            // Оператор префиксного инкремента - передвигает итератор на следующий узел списка.
+            BasicIterator& operator++()
+            {
+                pointerToNode = nodeLinks(pointerToNode)[0].next;
+                return *this;
+            }
+
+            // Оператор постфиксного инкремента - передвигает итератор и возвращает его прежнее значение.
+            BasicIterator operator++(int)
+            {
+                BasicIterator previous = *this;
+                ++*this;
+                return previous;
+            }
+
+            // Операторы сравнения - проверяют итераторы на равенство.
+            template <bool OtherConst>
+            bool operator==(const BasicIterator<OtherConst>& other) const {
+                return pointerToNode == other.pointerToNode;
+            }
+
+            template <bool OtherConst>
+            bool operator!=(const BasicIterator<OtherConst>& other) const {
+                return pointerToNode != other.pointerToNode;
+            }
+        };
+
+        using Iterator = BasicIterator<false>;
+        using ConstIterator = BasicIterator<true>;
+
+        // Имена типов, которые ожидают стандартные алгоритмы.
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = Iterator;
+        using const_iterator = ConstIterator;
+
+        // Метод возвращает итератор, который смотрит на голову списка.
+        Iterator begin() {
+            return Iterator(headLinks[0].next);
+        }
+
+        ConstIterator begin() const {
+            return ConstIterator(headLinks[0].next);
+        }
+
+        // Метод возвращает итератор, который смотрит на узел, следующий за хвостом (это всегда nullptr).
+        Iterator end() {
+            return Iterator(nullptr);
+        }
+
+        ConstIterator end() const {
+            return ConstIterator(nullptr);
+        }
+
+        // Методы возвращают итераторы только для чтения (даже для неконстантного списка).
+        ConstIterator cbegin() const {
+            return ConstIterator(headLinks[0].next);
+        }
+
+        ConstIterator cend() const {
+            return ConstIterator(nullptr);
+        }
+
+        // Конструктор по умолчанию.
+        IndexedLinkedList() : IndexedLinkedList(Allocator()) {}
+
+        // Конструктор, принимающий аллокатор узлов.
+        explicit IndexedLinkedList(const Allocator& allocator)
+        : sizeOfList(0), levelCount(1), headLinks(), randomState(0x9E3779B97F4A7C15ull), allocator(allocator) {}
+
+        // Пользовательский конструктор.
+        IndexedLinkedList(const std::initializer_list<T>& list, const Allocator& allocator = Allocator())
+        : IndexedLinkedList(allocator)
+        {
+            for (const T& value: list) {
+                this->pushBack(value);
+            }
+        }
+
+        // Конструктор глубокого копирования.
+        IndexedLinkedList(const IndexedLinkedList& other)
+        : IndexedLinkedList(Allocator(UnitTraits::select_on_container_copy_construction(other.allocator)))
+        {
+            for (const T& value: other) {
+                this->pushBack(value);
+            }
+        }
+
+        // Конструктор копирования перемещением (забирает узлы other, оставляя его пустым).
+        IndexedLinkedList(IndexedLinkedList&& other) noexcept
+        : IndexedLinkedList(Allocator(other.allocator))
+        {
+            stealFrom(other);
+        }
+
+        // Деструктор.
+        ~IndexedLinkedList() {
+            this->clear();
+        }
+
+        // Оператор глубокого копирования.
+        IndexedLinkedList& operator=(const IndexedLinkedList& other)
+        {
+            if (this == &other) {
+                return *this;
+            }
+
+            this->clear();
+
+            if constexpr (UnitTraits::propagate_on_container_copy_assignment::value) {
+                allocator = other.allocator;
+            }
+
+            for (const T& value: other) {
+                this->pushBack(value);
+            }
+
+            return *this;
+        }
+
+        // Оператор присваивания перемещением.
+        IndexedLinkedList& operator=(IndexedLinkedList&& other)
+            noexcept(UnitTraits::propagate_on_container_move_assignment::value || UnitTraits::is_always_equal::value)
+        {
+            if (this == &other) {
+                return *this;
+            }
+
+            this->clear();
+
+            // Узлы other можно забрать, только если наш аллокатор способен их освободить.
+            if constexpr (!UnitTraits::propagate_on_container_move_assignment::value)
+            {
+                if (allocator != other.allocator)
+                {
+                    for (T& value: other) {
+                        this->pushBack(std::move(value));
+                    }
+
+                    other.clear();
+                    return *this;
+                }
+            }
+            else {
+                allocator = other.allocator;
+            }
+
+            stealFrom(other);
+
+            return *this;
+        }
+
+        // Метод возвращает копию аллокатора, которым пользуется список.
+        Allocator getAllocator() const {
+            return Allocator(allocator);
+        }
+
+        /*
+        1.  Данный оператор предоставляет доступ к элементам списка по индексу (аналогично массивам).
+        2.  Доступна как положительная, так и отрицательная индексация (последний элемент имеет индекс -1).
+        3.  Обращение к элементу по индексу имеет сложность O(log n) в среднем.
+        */
+        T& operator[](int index) {
+            return nodeAt(normalizeIndex(index))->value;
+        }
+
+        const T& operator[](int index) const {
+            return nodeAt(normalizeIndex(index))->value;
+        }
+
+        /*  Метод показывает, является ли список пустым.
+            Возвращает соответствующее булевое значение.  */
+        bool isEmpty() const {
+            return sizeOfList == 0;
+        }
+
+        // Метод возвращает длину списка на текущий момент.
+        size_t size() const {
+            return sizeOfList;
+        }
+
+        // Метод возвращает значение первого элемента списка по ссылке.
+        T& front() const
+        {
+            if (sizeOfList == 0) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the first element.");
+            }
+
+            return headLinks[0].next->value;
+        }
+
+        // Метод возвращает значение последнего элемента списка по ссылке (за O(log n)).
+        T& back() const
+        {
+            if (sizeOfList == 0) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the last element.");
+            }
+
+            return nodeAt(sizeOfList - 1)->value;
+        }
+
+        // Метод выводит значения всех элементов в порядке их расположения в списке.
+        void print() const
+        {
+            for (const T& value: *this) {
+                std::cout << value << ' ';
+            }
+
+            std::cout << '\n';
+        }
+
+        /*  Метод ищет первый элемент со значением value и возвращает указатель 
+            на этот элемент. Если элемент не найден - возвращает nullptr.  */
+        T* find(const T& value) const
+        {
+            for (SkipNode* current = headLinks[0].next; current != nullptr; current = nodeLinks(current)[0].next)
+            {
+                if (current->value == value) {
+                    return &current->value;
+                }
+            }
+
+            return nullptr;
+        }
+
+        /*  Метод проверяет, есть ли в списке элемент со значением value.
+            Возвращает соответствующее булевое значение.  */
+        bool contains(const T& value) const {
+            return find(value) != nullptr;
+        }
+
+        // Метод полностью очищает список.
+        void clear()
+        {
+            SkipNode* current = headLinks[0].next;
+
+            while (current != nullptr)
+            {
+                SkipNode* next = linksOf(current)[0].next;
+                destroyNode(current);
+                current = next;
+            }
+
+            sizeOfList = 0;
+            levelCount = 1;
+            std::fill(headLinks, headLinks + maxLevels, SkipLink{nullptr, 0});
+        }
+
+        /*  Метод удаляет первый элемент со значением valueToRemove.
+            Возвращает true, если элемент с соответствующим значением был найден и удалён, иначе - false.  */
+        bool remove(const T& valueToRemove)
+        {
+            size_t index = 0;
+
+            for (Iterator it = begin(); it != end(); ++it, ++index)
+            {
+                if (*it == valueToRemove)
+                {
+                    eraseAt(index);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /*  Метод удаляет все узлы со значением valueToRemove за один проход по нижнему уровню (O(n)):
+            ссылки всех уровней перестраиваются на ходу между оставшимися узлами, а их ширины пересчитываются.
+            Возвращает true, если хотя бы один узел был удалён, иначе - false. */
+        bool removeAll(const T& valueToRemove)
+        {
+            // 1. На каждом уровне запоминаю последний оставленный узел (nullptr - заголовок) и его позицию.
+            SkipNode* last[maxLevels];
+            size_t lastRank[maxLevels];
+
+            std::fill(last, last + levelCount, nullptr);
+            std::fill(lastRank, lastRank + levelCount, size_t{0});
+
+            size_t kept = 0;
+
+            // 2. Оставленный узел подвешивается на уровнях своей башни за последним оставленным узлом.
+            auto keep = [&](SkipNode* node)
+            {
+                ++kept;
+
+                for (unsigned level = 0; level < node->height; ++level)
+                {
+                    linksOf(last[level])[level] = SkipLink{node, kept - lastRank[level]};
+                    last[level] = node;
+                    lastRank[level] = kept;
+                }
+            };
+
+            // 3. Прохожу нижний уровень: совпавшие узлы удаляю, остальные оставляю.
+            SkipNode* current = headLinks[0].next;
+
+            try
+            {
+                while (current != nullptr)
+                {
+                    SkipNode* next = linksOf(current)[0].next;
+
+                    if (current->value == valueToRemove) {
+                        destroyNode(current);
+                    }
+                    else {
+                        keep(current);
+                    }
+
+                    current = next;
+                }
+            }
+            catch (...)
+            {
+                // Сравнение выбросило исключение - узел current и все узлы после него остаются в списке.
+                while (current != nullptr)
+                {
+                    SkipNode* next = linksOf(current)[0].next;
+                    keep(current);
+                    current = next;
+                }
+
+                finishRelink(last, kept);
+                throw;
+            }
+
+            const bool removed = kept != sizeOfList;
+            finishRelink(last, kept);
+
+            return removed;
+        }
+
+        // Метод вставляет элемент со значением value так, чтобы он получил индекс index (0 <= index <= size()).
+        void insertAt(size_t index, const T& value) {
+            emplaceAt(index, value);
+        }
+
+        void insertAt(size_t index, T&& value) {
+            emplaceAt(index, std::move(value));
+        }
+
+        /*  Метод конструирует элемент из аргументов args так, чтобы он получил индекс index (0 <= index <= size()).
+            Сложность - O(log n) в среднем. Возвращает ссылку на созданный элемент.  */
+        template <typename... Args>
+        T& emplaceAt(size_t index, Args&&... args)
+        {
+            // 1. Если значение индекса выходит за пределы - выбрасываю исключение.
+            if (index > sizeOfList) {
+                throw std::out_of_range("Error! The index is out of range.");
+            }
+
+            // 2. Создаю узел со случайной высотой башни.
+            const unsigned height = randomHeight();
+            SkipNode* newNode = createNode(height, std::forward<Args>(args)...);
+
+            // 3. Если башня выше всех существующих - новые уровни начинаются в заголовке.
+            SkipNode* update[maxLevels];
+            size_t rank[maxLevels];
+
+            for (unsigned level = levelCount; level < height; ++level) {
+                headLinks[level] = SkipLink{nullptr, 0};
+            }
+
+            levelCount = std::max(levelCount, height);
+
+            // 4. Нахожу предшественников новой позиции (index + 1) на каждом уровне.
+            findPredecessors(index + 1, update, rank);
+
+            /* 5.   На уровнях башни вставляю узел между предшественником и его следующим узлом,
+                    разделяя ширину ссылки предшественника на две части.  */
+            SkipLink* newLinks = linksOf(newNode);
+
+            for (unsigned level = 0; level < height; ++level)
+            {
+                SkipLink& link = linksOf(update[level])[level];
+
+                newLinks[level].next = link.next;
+                newLinks[level].width = link.next != nullptr ? link.width - (index - rank[level]) : 0;
+
+                link.next = newNode;
+                link.width = index + 1 - rank[level];
+            }
+
+            // 6. Ссылки более высоких уровней теперь перескакивают на один узел больше.
+            for (unsigned level = height; level < levelCount; ++level)
+            {
+                SkipLink& link = linksOf(update[level])[level];
+
+                if (link.next != nullptr) {
+                    ++link.width;
+                }
+            }
+
+            ++sizeOfList;
+
+            return newNode->value;
+        }
+
+        /*  Метод удаляет элемент с индексом index (0 <= index < size()) за O(log n) в среднем.
+            Возвращает значение удаленного элемента.  */
+        T eraseAt(size_t index)
+        {
+            // 1. Если значение индекса выходит за пределы - выбрасываю исключение.
+            if (index >= sizeOfList) {
+                throw std::out_of_range("Error! The index is out of range.");
+            }
+
+            // 2. Нахожу предшественников удаляемой позиции (index + 1) на каждом уровне.
+            SkipNode* update[maxLevels];
+            size_t rank[maxLevels];
+
+            findPredecessors(index + 1, update, rank);
+
+            SkipNode* nodeToRemove = linksOf(update[0])[0].next;
+            SkipLink* removedLinks = linksOf(nodeToRemove);
+
+            // 3. На уровнях башни ссылка предшественника поглощает ссылку удаляемого узла.
+            for (unsigned level = 0; level < levelCount; ++level)
+            {
+                SkipLink& link = linksOf(update[level])[level];
+
+                if (level < nodeToRemove->height)
+                {
+                    link.next = removedLinks[level].next;
+                    link.width = link.next != nullptr ? link.width + removedLinks[level].width - 1 : 0;
+                }
+                else if (link.next != nullptr) {
+                    --link.width;
+                }
+            }
+
+            // 4. Опустевшие верхние уровни убираю.
+            while (levelCount > 1 && headLinks[levelCount - 1].next == nullptr) {
+                --levelCount;
+            }
+
+            T deleted = std::move(nodeToRemove->value);
+            destroyNode(nodeToRemove);
+            --sizeOfList;
+
+            return deleted;
+        }
+
+        // Метод добавляет новый элемент в начало списка.
+        void pushFront(const T& value) {
+            emplaceAt(0, value);
+        }
+
+        void pushFront(T&& value) {
+            emplaceAt(0, std::move(value));
+        }
+
+        // Метод добавляет новый элемент в конец списка.
+        void pushBack(const T& value) {
+            emplaceAt(sizeOfList, value);
+        }
+
+        void pushBack(T&& value) {
+            emplaceAt(sizeOfList, std::move(value));
+        }
+
+        // Методы конструируют новый элемент в начале / конце списка из аргументов args.
+        template <typename... Args>
+        T& emplaceFront(Args&&... args) {
+            return emplaceAt(0, std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        T& emplaceBack(Args&&... args) {
+            return emplaceAt(sizeOfList, std::forward<Args>(args)...);
+        }
+
+        /*  Метод удаляет первый элемент из списка.
+            Возвращает значение удаленного элемента.  */
+        T popFront()
+        {
+            if (sizeOfList == 0) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            return eraseAt(0);
+        }
+
+        /*  Метод удаляет последний элемент из списка за O(log n).
+            Возвращает значение удаленного элемента.  */
+        T popBack()
+        {
+            if (sizeOfList == 0) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            return eraseAt(sizeOfList - 1);
+        }
+    };
+
+    /*  HashedLinkedList - шаблонный класс, описывающий связанный список с хеш-индексом по значениям.
+        1.  Элементы хранятся в порядке вставки (как в LinkedList), но дополнительно список поддерживает
+        хеш-таблицу "значение -> цепочка узлов с этим значением". Поэтому find(), contains() и remove()
+        выполняются за O(1) в среднем, а removeAll() и count() - за O(k), где k - число совпадений.
+        2.  Узлы связаны в двусвязный список (это дает удаление найденного узла, popBack() за O(1)),
+        а узлы с равными значениями - в отдельную двусвязную цепочку в порядке их следования в списке.
+        3.  Накладные расходы индекса (64-битная платформа): 3 дополнительных указателя в каждом узле
+        (24 байта) плюс одна запись хеш-таблицы на каждое различное значение (~40 байт вместе с корзиной).
+        4.  Важно! Значения нельзя изменять на месте (от них зависит индекс), поэтому доступ к элементам
+        предоставляется только по константной ссылке.  */
+    template <typename T, typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>,
+              typename Allocator = std::allocator<T>>
+    class HashedLinkedList
+    {
+    private:
+        // HashedNode - cтруктура узла.
+        struct HashedNode
+        {
+            // Значение, хранящееся в узле.
+            T value;
+
+            // Соседи по списку.
+            HashedNode* prev;
+            HashedNode* next;
+
+            // Соседи по цепочке узлов с равными значениями.
+            HashedNode* prevEqual;
+            HashedNode* nextEqual;
+
+            template <typename... Args>
+            HashedNode(std::in_place_t, Args&&... args)
+            : value(std::forward<Args>(args)...), prev(nullptr), next(nullptr), prevEqual(nullptr), nextEqual(nullptr) {}
+        };
+
+        // EqualChain - первый и последний узлы цепочки равных значений.
+        struct EqualChain
+        {
+            HashedNode* first;
+            HashedNode* last;
+        };
+
+        /*  ValueKey - ключ хеш-таблицы: указатель на значение первого узла цепочки.
+            1.  Хешируется и сравнивается само значение, поэтому искать можно по адресу любого равного значения.
+            2.  Указатель объявлен mutable: когда первый узел цепочки удаляется, ключ перенаправляется
+            на равное значение следующего узла прямо на месте (хеш ключа при этом не меняется).  */
+        struct ValueKey
+        {
+            mutable const T* value;
+        };
+
+        struct KeyHash
+        {
+            Hash hash;
+
+            size_t operator()(const ValueKey& key) const {
+                return hash(*key.value);
+            }
+        };
+
+        struct KeyEquality
+        {
+            KeyEqual equal;
+
+            bool operator()(const ValueKey& first, const ValueKey& second) const {
+                return equal(*first.value, *second.value);
+            }
+        };
+
+        using IndexAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::pair<const ValueKey, EqualChain>>;
+        using Index = std::unordered_map<ValueKey, EqualChain, KeyHash, KeyEquality, IndexAllocator>;
+
+        // Размер списка на текущий момент.
+        size_t sizeOfList;
+
+        // Указатель на первый узел списка.
+        HashedNode* head;
+
+        // Указатель на последний узел списка.
+        HashedNode* tail;
+
+        // Хеш-индекс: значение -> цепочка узлов с этим значением.
+        Index index;
+
+        // Аллокатор узлов (аллокатор Allocator, перепривязанный к типу HashedNode).
+        using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<HashedNode>;
+        using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+        [[no_unique_address]] NodeAllocator allocator;
+
+        // Метод выделяет память под узел через аллокатор и конструирует в нем значение из аргументов args.
+        template <typename... Args>
+        HashedNode* createNode(Args&&... args)
+        {
+            HashedNode* node = NodeTraits::allocate(allocator, 1);
+
+            try {
+                NodeTraits::construct(allocator, node, std::in_place, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                NodeTraits::deallocate(allocator, node, 1);
+                throw;
+            }
+
+            return node;
+        }
+
+        // Метод разрушает узел и возвращает его память аллокатору.
+        void destroyNode(HashedNode* node)
+        {
+            NodeTraits::destroy(allocator, node);
+            NodeTraits::deallocate(allocator, node, 1);
+        }
+
+        // Метод делает узел newFirst головой цепочки, а его значение - ключом записи индекса.
+        static void rekey(typename Index::iterator entry, HashedNode* newFirst)
+        {
+            entry->first.value = &newFirst->value;
+            entry->second.first = newFirst;
+        }
+
+        /*  Метод регистрирует новый узел в индексе.
+            atFront == true - узел стоит в списке раньше всех равных ему узлов, иначе - позже всех.  */
+        void indexNode(HashedNode* node, bool atFront)
+        {
+            auto entry = index.find(ValueKey{&node->value});
+
+            // 1. Если равных значений еще нет - создаю новую цепочку из одного узла.
+            if (entry == index.end())
+            {
+                try {
+                    index.emplace(ValueKey{&node->value}, EqualChain{node, node});
+                }
+                catch (...)
+                {
+                    destroyNode(node);
+                    throw;
+                }
+
+                return;
+            }
+
+            // 2. Иначе подвешиваю узел к началу или к концу существующей цепочки.
+            EqualChain& chain = entry->second;
+
+            if (atFront)
+            {
+                node->nextEqual = chain.first;
+                chain.first->prevEqual = node;
+                rekey(entry, node);
+            }
+            else
+            {
+                node->prevEqual = chain.last;
+                chain.last->nextEqual = node;
+                chain.last = node;
+            }
+        }
+
+        /*  Метод исключает узел из цепочки равных значений и из индекса (узел остается в списке).
+            Запись индекса ищется по значению узла, поэтому оно еще не должно быть перемещено.  */
+        void unindexNode(HashedNode* node)
+        {
+            // Запись индекса нужна, только если узел - край цепочки.
+            if (node->prevEqual == nullptr || node->nextEqual == nullptr)
+            {
+                auto entry = index.find(ValueKey{&node->value});
+
+                if (node->prevEqual == nullptr && node->nextEqual == nullptr) {
+                    index.erase(entry);
+                }
+                else if (node->prevEqual == nullptr)
+                {
+                    node->nextEqual->prevEqual = nullptr;
+                    rekey(entry, node->nextEqual);
+                }
+                else
+                {
+                    node->prevEqual->nextEqual = nullptr;
+                    entry->second.last = node->prevEqual;
+                }
+            }
+            else
+            {
+                node->prevEqual->nextEqual = node->nextEqual;
+                node->nextEqual->prevEqual = node->prevEqual;
+            }
+        }
+
+        // Метод исключает узел из списка (но не из индекса) и освобождает его.
+        void unlinkNode(HashedNode* node)
+        {
+            if (node->prev != nullptr) {
+                node->prev->next = node->next;
+            }
+            else {
+                head = node->next;
+            }
+
+            if (node->next != nullptr) {
+                node->next->prev = node->prev;
+            }
+            else {
+                tail = node->prev;
+            }
+
+            destroyNode(node);
+            --sizeOfList;
+        }
+
+        // Метод исключает узел из индекса, из списка и освобождает его.
+        void eraseNode(HashedNode* node)
+        {
+            unindexNode(node);
+            unlinkNode(node);
+        }
+
+        /*  Метод исключает узел из индекса и из списка и возвращает его значение, перемещенное из узла.
+            Если перемещение выбросило исключение, узел все равно удаляется (список остается согласованным).  */
+        T extractNode(HashedNode* node)
+        {
+            // 1. Сначала исключаю узел из индекса - запись ищется по еще не перемещенному значению.
+            unindexNode(node);
+
+            // 2. Перемещаю значение из узла (если перемещение выбросило исключение, узел все равно удаляется).
+            T deleted = [&]() -> T
+            {
+                try {
+                    return std::move(node->value);
+                }
+                catch (...)
+                {
+                    unlinkNode(node);
+                    throw;
+                }
+            }();
+
+            // 3. Удаляю узел из списка (ровно один раз - после того, как значение уже вне узла).
+            unlinkNode(node);
+
+            return deleted;
+        }
+
+        // Метод возвращает первый узел со значением value (или nullptr).
+        HashedNode* firstEqual(const T& value) const
+        {
+            auto entry = index.find(ValueKey{&value});
+            return entry == index.end() ? nullptr : entry->second.first;
+        }
+
+    public:
+        using allocator_type = Allocator;
+
+        /*  Iterator - класс, описывающий структуру итератора 
+            (объекта, с помощью которого можно итерироваться по списку). Элементы доступны только для чтения.  */
+        class Iterator
+        {
+        private:
+            // Указатель на узел, на который смотрит итератор.
+            HashedNode* pointerToNode;
+
+        public:
+            // Информация об итераторе для библиотеки <algorithm>:
+            using iterator_category = std::forward_iterator_tag;   // Тип итератора.
+            using value_type = T;                                  // Тип элемента.
+            using difference_type = std::ptrdiff_t;                // Разница между итераторами.
+            using pointer = const T*;                              // Указатель на элемент.
+            using reference = const T&;                            // Ссылка на элемент.
+
+            Iterator(HashedNode* somePointer) : pointerToNode(somePointer) {}
+
+            // Оператор разыменования - возвращает значение узла (на который смотрит итератор) по константной ссылке.
+            reference operator*() const {
+                return pointerToNode->value;
+            }
+
+            // Оператор префиксного инкремента - передвигает итератор на следующий узел списка.
+            Iterator& operator++()
+            {
+                pointerToNode = pointerToNode->next;
+                return *this;
+            }
+
+            // Операторы сравнения - проверяют итераторы на равенство.
+            bool operator==(const Iterator& other) const {
+                return pointerToNode == other.pointerToNode;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return pointerToNode != other.pointerToNode;
+            }
+        };
+
+        // Метод возвращает итератор, который смотрит на голову списка.
+        Iterator begin() const {
+            return Iterator(head);
+        }
+
+        // Метод возвращает итератор, который смотрит на узел, следующий за хвостом (это всегда nullptr).
+        Iterator end() const {
+            return Iterator(nullptr);
+        }
+
+        // Конструктор по умолчанию.
+        HashedLinkedList() : HashedLinkedList(Allocator()) {}
+
+        // Конструктор, принимающий аллокатор узлов.
+        explicit HashedLinkedList(const Allocator& allocator)
+        : sizeOfList(0), head(nullptr), tail(nullptr), index(IndexAllocator(allocator)), allocator(allocator) {}
+
+        // Пользовательский конструктор.
+        HashedLinkedList(const std::initializer_list<T>& list, const Allocator& allocator = Allocator())
+        : HashedLinkedList(allocator)
+        {
+            for (const T& value: list) {
+                this->pushBack(value);
+            }
+        }
+
+        // Конструктор глубокого копирования.
+        HashedLinkedList(const HashedLinkedList& other)
+        : HashedLinkedList(Allocator(NodeTraits::select_on_container_copy_construction(other.allocator)))
+        {
+            for (const T& value: other) {
+                this->pushBack(value);
+            }
+        }
+
+        /*  Конструктор копирования перемещением (забирает узлы и индекс other, оставляя его пустым).
+            Не выбрасывает исключений, если их не выбрасывает перемещение индекса, поэтому std::vector
+            при росте перемещает такие списки, а не копирует их вместе с индексом.  */
+        HashedLinkedList(HashedLinkedList&& other) noexcept(std::is_nothrow_move_constructible_v<Index>)
+        : sizeOfList(other.sizeOfList), head(other.head), tail(other.tail),
+          index(std::move(other.index)), allocator(std::move(other.allocator))
+        {
+            other.sizeOfList = 0;
+            other.head = nullptr;
+            other.tail = nullptr;
+        }
+
+        // Деструктор.
+        ~HashedLinkedList() {
+            this->clear();
+        }
+
+        // Оператор глубокого копирования.
+        HashedLinkedList& operator=(const HashedLinkedList& other)
+        {
+            if (this == &other) {
+                return *this;
+            }
+
+            this->clear();
+
+            // Если аллокатор должен копироваться вместе со списком - забираю аллокатор другого списка (и для индекса).
+            if constexpr (NodeTraits::propagate_on_container_copy_assignment::value)
+            {
+                allocator = other.allocator;
+                index = Index(0, index.hash_function(), index.key_eq(), IndexAllocator(other.allocator));
+            }
+
+            for (const T& value: other) {
+                this->pushBack(value);
+            }
+
+            return *this;
+        }
+
+        // Оператор присваивания перемещением.
+        HashedLinkedList& operator=(HashedLinkedList&& other)
+            noexcept((NodeTraits::propagate_on_container_move_assignment::value || NodeTraits::is_always_equal::value)
+                     && std::is_nothrow_move_assignable_v<Index>)
+        {
+            if (this == &other) {
+                return *this;
+            }
+
+            this->clear();
+
+            // Узлы other можно забрать, только если наш аллокатор способен их освободить.
+            if (!NodeTraits::propagate_on_container_move_assignment::value && allocator != other.allocator)
+            {
+                while (!other.isEmpty()) {
+                    this->pushBack(other.popFront());
+                }
+
+                return *this;
+            }
+
+            if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+                allocator = other.allocator;
+            }
+
+            sizeOfList = other.sizeOfList;
+            head = other.head;
+            tail = other.tail;
+            index = std::move(other.index);
+
+            other.sizeOfList = 0;
+            other.head = nullptr;
+            other.tail = nullptr;
+            other.index.clear();
+
+            return *this;
+        }
+
+        // Метод возвращает копию аллокатора, которым пользуется список.
+        Allocator getAllocator() const {
+            return Allocator(allocator);
+        }
+
+        /*
+        1.  Данный оператор предоставляет доступ к элементам списка по индексу (только для чтения).
+        2.  Доступна как положительная, так и отрицательная индексация (последний элемент имеет индекс -1).
+        3.  Обход начинается с ближайшего конца списка, сложность - O(n).
+        */
+        const T& operator[](int index) const
+        {
+            if (index < -int(sizeOfList) || index >= int(sizeOfList)) {
+                throw std::out_of_range("Error! The index is out of range.");
+            }
+
+            const size_t position = index < 0 ? sizeOfList + index : size_t(index);
+            HashedNode* tempPtr;
+
+            if (position < sizeOfList / 2)
+            {
+                tempPtr = head;
+                for (size_t i = 0; i < position; ++i) {
+                    tempPtr = tempPtr->next;
+                }
+            }
+            else
+            {
+                tempPtr = tail;
+                for (size_t i = sizeOfList - 1; i > position; --i) {
+                    tempPtr = tempPtr->prev;
+                }
+            }
+
+            return tempPtr->value;
+        }
+
+        /*  Метод показывает, является ли список пустым.
+            Возвращает соответствующее булевое значение.  */
+        bool isEmpty() const {
+            return head == nullptr;
+        }
+
+        // Метод возвращает длину списка на текущий момент.
+        size_t size() const {
+            return sizeOfList;
+        }
+
+        // Метод возвращает количество различных значений в списке.
+        size_t distinctCount() const {
+            return index.size();
+        }
+
+        // Метод возвращает значение первого узла списка по константной ссылке.
+        const T& front() const
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the first element.");
+            }
+
+            return head->value;
+        }
+
+        // Метод возвращает значение последнего узла списка по константной ссылке.
+        const T& back() const
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the last element.");
+            }
+
+            return tail->value;
+        }
+
+        // Метод выводит значения всех узлов в порядке их расположения в списке.
+        void print() const
+        {
+            for (const T& value: *this) {
+                std::cout << value << ' ';
+            }
+
+            std::cout << '\n';
+        }
+
+        /*  Метод ищет первый узел со значением value за O(1) в среднем и возвращает указатель
+            на значение этого узла. Если узел не найден - возвращает nullptr.  */
+        const T* find(const T& value) const
+        {
+            HashedNode* node = firstEqual(value);
+            return node == nullptr ? nullptr : &node->value;
+        }
+
+        /*  Метод проверяет, есть ли в списке узел со значением value (за O(1) в среднем).
+            Возвращает соответствующее булевое значение.  */
+        bool contains(const T& value) const {
+            return index.find(ValueKey{&value}) != index.end();
+        }
+
+        // Метод возвращает количество узлов со значением value (за O(k), где k - результат).
+        size_t count(const T& value) const
+        {
+            size_t result = 0;
+
+            for (HashedNode* node = firstEqual(value); node != nullptr; node = node->nextEqual) {
+                ++result;
+            }
+
+            return result;
+        }
+
+        // Метод полностью очищает список.
+        void clear()
+        {
+            while (head != nullptr)
+            {
+                HashedNode* next = head->next;
+                destroyNode(head);
+                head = next;
+            }
+
+            tail = nullptr;
+            sizeOfList = 0;
+            index.clear();
+        }
+
+        /*  Метод удаляет первый узел со значением valueToRemove (за O(1) в среднем).
+            Возвращает true, если узел с соответствующим значением был найден и удалён, иначе - false.  */
+        bool remove(const T& valueToRemove)
+        {
+            HashedNode* node = firstEqual(valueToRemove);
+
+            if (node == nullptr) {
+                return false;
+            }
+
+            eraseNode(node);
+            return true;
+        }
+
+        /*  Метод удаляет все узлы со значением valueToRemove (за O(k), где k - число таких узлов).
+            Возвращает true, если хотя бы один узел был удалён, иначе - false. */
+        bool removeAll(const T& valueToRemove)
+        {
+            auto entry = index.find(ValueKey{&valueToRemove});
+
+            if (entry == index.end()) {
+                return false;
+            }
+
+            // 1. Забираю цепочку и удаляю запись индекса целиком (ключ указывает на значение первого узла).
+            HashedNode* node = entry->second.first;
+            index.erase(entry);
+
+            // 2. Исключаю узлы цепочки из списка.
+            while (node != nullptr)
+            {
+                HashedNode* nextEqual = node->nextEqual;
+                unlinkNode(node);
+                node = nextEqual;
+            }
+
+            return true;
+        }
+
+        // Метод добавляет новый элемент в начало списка.
+        void pushFront(const T& value) {
+            emplaceFront(value);
+        }
+
+        void pushFront(T&& value) {
+            emplaceFront(std::move(value));
+        }
+
+        // Метод добавляет новый элемент в конец списка.
+        void pushBack(const T& value) {
+            emplaceBack(value);
+        }
+
+        void pushBack(T&& value) {
+            emplaceBack(std::move(value));
+        }
+
+        /*  Метод конструирует новый элемент в начале списка из аргументов args.
+            Возвращает константную ссылку на созданный элемент.  */
+        template <typename... Args>
+        const T& emplaceFront(Args&&... args)
+        {
+            HashedNode* newNode = createNode(std::forward<Args>(args)...);
+            indexNode(newNode, true);
+
+            newNode->next = head;
+
+            if (head != nullptr) {
+                head->prev = newNode;
+            }
+            else {
+                tail = newNode;
+            }
+
+            head = newNode;
+            ++sizeOfList;
+
+            return newNode->value;
+        }
+
+        /*  Метод конструирует новый элемент в конце списка из аргументов args.
+            Возвращает константную ссылку на созданный элемент.  */
+        template <typename... Args>
+        const T& emplaceBack(Args&&... args)
+        {
+            HashedNode* newNode = createNode(std::forward<Args>(args)...);
+            indexNode(newNode, false);
+
+            newNode->prev = tail;
+
+            if (tail != nullptr) {
+                tail->next = newNode;
+            }
+            else {
+                head = newNode;
+            }
+
+            tail = newNode;
+            ++sizeOfList;
+
+            return newNode->value;
+        }
+
+        /*  Метод удаляет первый элемент из списка.
+            Возвращает значение удаленного элемента (значение перемещается из узла, а не копируется).  */
+        T popFront()
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            return extractNode(head);
+        }
+
+        /*  Метод удаляет последний элемент из списка за O(1).
+            Возвращает значение удаленного элемента (значение перемещается из узла, а не копируется).  */
+        T popBack()
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            return extractNode(tail);
+        }
+    };
+
+    /*  SharedLinkedList - шаблонный класс, описывающий односвязный список с разделяемыми узлами
+        (copy-on-write, структурное разделение).
+        1.  Копирование списка выполняется за O(1): копия не дублирует узлы, а ссылается на ту же цепочку.
+        У каждого узла есть счетчик ссылок (сколько списков и узлов указывают на него),
+        узел освобождается, когда счетчик обнуляется.
+        2.  pushFront() и popFront() выполняются за O(1) и не копируют узлы: новый узел копии ссылается
+        на общий хвост. Узел копируется лениво - только когда изменяющий метод должен изменить
+        разделяемый узел (или указатель в нем). Тогда копируются узлы от головы до изменяемого места.
+        3.  Значения нельзя изменять на месте по ссылке (изменение стало бы видно всем копиям),
+        поэтому элементы доступны только по константной ссылке, а для записи предназначен метод set().
+        4.  Разные объекты списка, разделяющие узлы, можно использовать из разных потоков одновременно
+        (например, читать снимок в одном потоке и изменять исходный список в другом):
+        счетчики ссылок атомарны. Один и тот же объект, как и у остальных контейнеров, требует
+        внешней синхронизации, если хотя бы один из потоков его изменяет.
+        5.  Важно! Последний владелец узла может оказаться в любом потоке, поэтому аллокатор должен
+        допускать освобождение памяти из другого потока (PoolAllocator этого не допускает - с ним
+        снимки следует уничтожать в потоке-владельце).  */
+    template <typename T, typename Allocator = std::allocator<T>>
+    class SharedLinkedList
+    {
+    private:
+        // SharedNode - cтруктура узла.
+        struct SharedNode
+        {
+            // Количество указателей на узел (из списков и из других узлов).
+            std::atomic<size_t> refs;
+
+            // Значение, хранящееся в узле.
+            T value;
+
+            // Указатель на следующий узел.
+            SharedNode* next;
+
+            template <typename... Args>
+            SharedNode(std::in_place_t, Args&&... args)
+            : refs(1), value(std::forward<Args>(args)...), next(nullptr) {}
+        };
+
+        // Размер списка на текущий момент.
+        size_t sizeOfList;
+
+        // Указатель на первый узел списка.
+        SharedNode* head;
+
+        // Указатель на последний узел списка.
+        SharedNode* tail;
+
+        /*  Флаг "узлы списка могли быть разделены с другим списком". Пока он снят, все узлы
+            принадлежат только этому списку и изменяются на месте без проверки счетчиков.
+            Устанавливается при копировании (в том числе в списке-источнике, поэтому mutable и атомарный:
+            копии одного объекта могут создаваться из нескольких потоков одновременно).  */
+        mutable std::atomic<bool> maybeShared;
+
+        // Аллокатор узлов (аллокатор Allocator, перепривязанный к типу SharedNode).
+        using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<SharedNode>;
+        using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+        [[no_unique_address]] NodeAllocator allocator;
+
+        // Метод выделяет память под узел через аллокатор и конструирует в нем значение из аргументов args.
+        template <typename... Args>
+        SharedNode* createNode(Args&&... args)
+        {
+            SharedNode* node = NodeTraits::allocate(allocator, 1);
+
+            try {
+                NodeTraits::construct(allocator, node, std::in_place, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                NodeTraits::deallocate(allocator, node, 1);
+                throw;
+            }
+
+            return node;
+        }
+
+        /*  Метод снимает одну ссылку с узла node. Если ссылка была последней - узел освобождается,
+            и ссылка снимается уже с его преемника (итеративно, чтобы не переполнить стек на длинных цепочках).  */
+        void release(SharedNode* node)
+        {
+            while (node != nullptr && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                SharedNode* next = node->next;
+                NodeTraits::destroy(allocator, node);
+                NodeTraits::deallocate(allocator, node, 1);
+                node = next;
+            }
+        }
+
+        // Метод делает список разделяющим цепочку other (O(1)).
+        void share(const SharedLinkedList& other)
+        {
+            if (other.head != nullptr)
+            {
+                other.head->refs.fetch_add(1, std::memory_order_relaxed);
+                other.maybeShared.store(true, std::memory_order_relaxed);
+                maybeShared.store(true, std::memory_order_relaxed);
+            }
+
+            sizeOfList = other.sizeOfList;
+            head = other.head;
+            tail = other.tail;
+        }
+
+        /*  Метод гарантирует, что первые count узлов принадлежат только этому списку, и возвращает указатель
+            на узел с индексом count - 1 (или nullptr при count == 0).
+            1.  Узел, на который ссылается кто-то еще, заменяется своей копией. Копия ссылается на того же
+            преемника, поэтому у преемника появляется вторая ссылка, и он тоже будет скопирован - так
+            копируется весь разделяемый участок от головы до нужного места, а хвост остается общим.
+            2.  Если copy-конструктор T выбросит исключение, список останется корректным и с прежними значениями.  */
+        SharedNode* unsharePrefix(size_t count)
+        {
+            SharedNode* previous = nullptr;
+            SharedNode** link = &head;
+
+            if (!maybeShared.load(std::memory_order_relaxed))
+            {
+                if (count == sizeOfList) {
+                    return tail;
+                }
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    previous = *link;
+                    link = &previous->next;
+                }
+
+                return previous;
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                SharedNode* node = *link;
+
+                // acquire - чтобы чтения значения другими владельцами (до их release) завершились раньше изменений.
+                if (node->refs.load(std::memory_order_acquire) != 1)
+                {
+                    SharedNode* copy = createNode(node->value);
+                    copy->next = node->next;
+
+                    if (copy->next != nullptr) {
+                        copy->next->refs.fetch_add(1, std::memory_order_relaxed);
+                    }
+
+                    *link = copy;
+
+                    if (tail == node) {
+                        tail = copy;
+                    }
+
+                    release(node);
+                    node = copy;
+                }
+
+                previous = node;
+                link = &node->next;
+            }
+
+            // Вся цепочка теперь принадлежит только этому списку.
+            if (count == sizeOfList) {
+                maybeShared.store(false, std::memory_order_relaxed);
+            }
+
+            return previous;
+        }
+
+        /*  Метод исключает из списка узел, на который указывает *link (предшествующие узлы
+            должны принадлежать только этому списку). previous - узел, владеющий *link (nullptr для головы).  */
+        void unlink(SharedNode** link, SharedNode* previous)
+        {
+            SharedNode* node = *link;
+            SharedNode* next = node->next;
+
+            // Ссылка на преемника переходит от node к предшественнику, ссылка на node снимается.
+            if (next != nullptr) {
+                next->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            *link = next;
+
+            if (tail == node) {
+                tail = previous;
+            }
+
+            release(node);
+            --sizeOfList;
+        }
+
+        // Метод возвращает значение узла node: перемещает его, если узел больше никому не доступен, иначе - копирует.
+        static T takeValue(SharedNode* node)
+        {
+            if (node->refs.load(std::memory_order_acquire) == 1) {
+                return T(std::move(node->value));
+            }
+
+            return T(node->value);
+        }
+
+        // Метод возвращает индекс последнего узла со значением value (или sizeOfList, если таких нет).
+        size_t lastIndexOf(const T& value) const
+        {
+            size_t last = sizeOfList;
+            size_t position = 0;
+
+            for (SharedNode* tempPtr = head; tempPtr != nullptr; tempPtr = tempPtr->next, ++position)
+            {
+                CONTAINERS_PREFETCH(tempPtr->next);
+
+                if (tempPtr->value == value) {
+                    last = position;
+                }
+            }
+
+            return last;
+        }
+
+    public:
+        using allocator_type = Allocator;
+
+        /*  Iterator - класс, описывающий структуру итератора 
+            (объекта, с помощью которого можно итерироваться по списку). Элементы доступны только для чтения.  */
+        class Iterator
+        {
+        private:
+            // Указатель на узел, на который смотрит итератор.
+            SharedNode* pointerToNode;
+
+        public:
+            // Информация об итераторе для библиотеки <algorithm>:
+            using iterator_category = std::forward_iterator_tag;   // Тип итератора.
+            using value_type = T;                                  // Тип элемента.
+            using difference_type = std::ptrdiff_t;                // Разница между итераторами.
+            using pointer = const T*;                              // Указатель на элемент.
+            using reference = const T&;                            // Ссылка на элемент.
+
+            Iterator(SharedNode* somePointer) : pointerToNode(somePointer) {}
+
+            // Оператор разыменования - возвращает значение узла (на который смотрит итератор) по константной ссылке.
+            reference operator*() const {
+                return pointerToNode->value;
+            }
+
+            /*  Оператор префиксного инкремента - передвигает итератор на следующий узел списка
+                (и заранее подгружает в кэш узел, следующий за ним).  */
+            Iterator& operator++()
+            {
+                pointerToNode = pointerToNode->next;
+
+                if (pointerToNode != nullptr) {
+                    CONTAINERS_PREFETCH(pointerToNode->next);
+                }
+
+                return *this;
+            }
+
+            // Операторы сравнения - проверяют итераторы на равенство.
+            bool operator==(const Iterator& other) const {
+                return pointerToNode == other.pointerToNode;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return pointerToNode != other.pointerToNode;
+            }
+        };
+
+        // Метод возвращает итератор, который смотрит на голову списка.
+        Iterator begin() const {
+            return Iterator(head);
+        }
+
+        // Метод возвращает итератор, который смотрит на узел, следующий за хвостом (это всегда nullptr).
+        Iterator end() const {
+            return Iterator(nullptr);
+        }
+
+        // Конструктор по умолчанию.
+        SharedLinkedList() : SharedLinkedList(Allocator()) {}
+
+        // Конструктор, принимающий аллокатор узлов.
+        explicit SharedLinkedList(const Allocator& allocator)
+        : sizeOfList(0), head(nullptr), tail(nullptr), maybeShared(false), allocator(allocator) {}
+
+        // Пользовательский конструктор.
+        SharedLinkedList(const std::initializer_list<T>& list, const Allocator& allocator = Allocator())
+        : SharedLinkedList(allocator)
+        {
+            for (const T& value: list) {
+                this->pushBack(value);
+            }
+        }
+
+        /*  Конструктор копирования за O(1): копия разделяет узлы other.
+            Аллокатор копируется как есть (а не через select_on_container_copy_construction),
+            так как освобождать общие узлы может любой из списков.  */
+        SharedLinkedList(const SharedLinkedList& other)
+        : SharedLinkedList(Allocator(other.allocator))
+        {
+            share(other);
+        }
+
+        /*  Конструктор копирования перемещением (забирает узлы other, оставляя его пустым).
+            Не выбрасывает исключений, поэтому std::vector при росте перемещает списки, а не копирует их
+            (копия пометила бы оба списка разделяемыми, и следующий pushBack прошел бы весь список).  */
+        SharedLinkedList(SharedLinkedList&& other) noexcept
+        : sizeOfList(other.sizeOfList), head(other.head), tail(other.tail),
+          maybeShared(other.maybeShared.load(std::memory_order_relaxed)), allocator(std::move(other.allocator))
+        {
+            other.sizeOfList = 0;
+            other.head = nullptr;
+            other.tail = nullptr;
+            other.maybeShared.store(false, std::memory_order_relaxed);
+        }
+
+        // Деструктор.
+        ~SharedLinkedList() {
+            this->clear();
+        }
+
+        /*  Оператор копирования. Узлы other разделяются за O(1), если наш аллокатор способен их освободить
+            (аллокаторы равны или аллокатор other передается вместе с узлами), иначе значения копируются.  */
+        SharedLinkedList& operator=(const SharedLinkedList& other)
+        {
+            if (this == &other) {
+                return *this;
+            }
+
+            this->clear();
+
+            if (!NodeTraits::propagate_on_container_copy_assignment::value && allocator != other.allocator)
+            {
+                for (const T& value: other) {
+                    this->pushBack(value);
+                }
+
+                return *this;
+            }
+
+            if constexpr (NodeTraits::propagate_on_container_copy_assignment::value) {
+                allocator = other.allocator;
+            }
+
+            share(other);
+            return *this;
+        }
+
+        // Оператор присваивания перемещением.
+        SharedLinkedList& operator=(SharedLinkedList&& other)
+            noexcept(NodeTraits::propagate_on_container_move_assignment::value || NodeTraits::is_always_equal::value)
+        {
+            if (this == &other) {
+                return *this;
+            }
+
+            this->clear();
+
+            // Узлы other можно забрать, только если наш аллокатор способен их освободить.
+            if (!NodeTraits::propagate_on_container_move_assignment::value && allocator != other.allocator)
+            {
+                for (const T& value: other) {
+                    this->pushBack(value);
+                }
+
+                other.clear();
+                return *this;
+            }
+
+            if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+                allocator = other.allocator;
+            }
+
+            sizeOfList = other.sizeOfList;
+            head = other.head;
+            tail = other.tail;
+            maybeShared.store(other.maybeShared.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+            other.sizeOfList = 0;
+            other.head = nullptr;
+            other.tail = nullptr;
+            other.maybeShared.store(false, std::memory_order_relaxed);
+
+            return *this;
+        }
+
+        // Метод возвращает копию аллокатора, которым пользуется список.
+        Allocator getAllocator() const {
+            return Allocator(allocator);
+        }
+
+        /*  Метод показывает, разделяет ли список узлы с другим списком (хотя бы голову).
+            Результат актуален на момент вызова: другие копии могут быть уничтожены в любой момент.  */
+        bool isShared() const {
+            return head != nullptr && head->refs.load(std::memory_order_acquire) != 1;
+        }
+
+        /*
+        1.  Данный оператор предоставляет доступ к элементам списка по индексу (только для чтения).
+        2.  Доступна как положительная, так и отрицательная индексация (последний элемент имеет индекс -1).
+        3.  Сложность - O(n) (O(1) для последнего элемента).
+        */
+        const T& operator[](int index) const
+        {
+            if (index < -int(sizeOfList) || index >= int(sizeOfList)) {
+                throw std::out_of_range("Error! The index is out of range.");
+            }
+
+            const size_t position = index < 0 ? sizeOfList + index : size_t(index);
+
+            if (position == sizeOfList - 1) {
+                return tail->value;
+            }
+
+            SharedNode* tempPtr = head;
+
+            for (size_t i = 0; i < position; ++i) {
+                tempPtr = tempPtr->next;
+            }
+
+            return tempPtr->value;
+        }
+
+        /*  Метод записывает value в элемент с индексом index (допустима отрицательная индексация).
+            Разделяемые узлы от головы до index предварительно копируются, остальные копии списка не меняются.  */
+        void set(int index, const T& value)
+        {
+            if (index < -int(sizeOfList) || index >= int(sizeOfList)) {
+                throw std::out_of_range("Error! The index is out of range.");
+            }
+
+            const size_t position = index < 0 ? sizeOfList + index : size_t(index);
+            unsharePrefix(position + 1)->value = value;
+        }
+
+        /*  Метод показывает, является ли список пустым.
+            Возвращает соответствующее булевое значение.  */
+        bool isEmpty() const {
+            return head == nullptr;
+        }
+
+        // Метод возвращает длину списка на текущий момент.
+        size_t size() const {
+            return sizeOfList;
+        }
+
+        // Метод возвращает значение первого узла списка по константной ссылке.
+        const T& front() const
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the first element.");
+            }
+
+            return head->value;
+        }
+
+        // Метод возвращает значение последнего узла списка по константной ссылке.
+        const T& back() const
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the last element.");
+            }
+
+            return tail->value;
+        }
+
+        // Метод выводит значения всех узлов в порядке их расположения в списке.
+        void print() const
+        {
+            for (const T& value: *this) {
+                std::cout << value << ' ';
+            }
+
+            std::cout << '\n';
+        }
+
+        /*  Метод ищет первый узел со значением value и возвращает указатель на значение этого узла.
+            Если узел не найден - возвращает nullptr.  */
+        const T* find(const T& value) const
+        {
+            for (SharedNode* tempPtr = head; tempPtr != nullptr; tempPtr = tempPtr->next)
+            {
+                CONTAINERS_PREFETCH(tempPtr->next);
+
+                if (tempPtr->value == value) {
+                    return &tempPtr->value;
+                }
+            }
+
+            return nullptr;
+        }
+
+        /*  Метод проверяет, есть ли в списке узел со значением value.
+            Возвращает соответствующее булевое значение.  */
+        bool contains(const T& value) const {
+            return find(value) != nullptr;
+        }
+
+        /*  Метод снимает ссылки списка с узлов и делает список пустым за O(1) на каждый освобождаемый узел:
+            узлы, которые разделяют другие списки, остаются им.  */
+        void clear()
+        {
+            release(head);
+
+            head = nullptr;
+            tail = nullptr;
+            sizeOfList = 0;
+            maybeShared.store(false, std::memory_order_relaxed);
+        }
+
+        /*  Метод удаляет первый узел со значением valueToRemove.
+            Возвращает true, если узел с соответствующим значением был найден и удалён, иначе - false.  */
+        bool remove(const T& valueToRemove)
+        {
+            // 1. Ищу узел без изменения списка (разделяемые узлы копируются, только если он найден).
+            size_t position = 0;
+            SharedNode* tempPtr = head;
+
+            while (tempPtr != nullptr && !(tempPtr->value == valueToRemove))
+            {
+                CONTAINERS_PREFETCH(tempPtr->next);
+                tempPtr = tempPtr->next;
+                ++position;
+            }
+
+            if (tempPtr == nullptr) {
+                return false;
+            }
+
+            // 2. Делаю собственными узлы перед найденным и исключаю его.
+            SharedNode* previous = unsharePrefix(position);
+            unlink(previous == nullptr ? &head : &previous->next, previous);
+
+            return true;
+        }
+
+        /*  Метод удаляет все узлы со значением valueToRemove.
+            Возвращает true, если хотя бы один узел был удалён, иначе - false. */
+        bool removeAll(const T& valueToRemove)
+        {
+            // 1. Копировать нужно только узлы до последнего совпадения: хвост после него остается общим.
+            const size_t last = lastIndexOf(valueToRemove);
+
+            if (last == sizeOfList) {
+                return false;
+            }
+
+            unsharePrefix(last);
+
+            // 2. Исключаю совпадения среди первых last + 1 узлов.
+            SharedNode* previous = nullptr;
+            SharedNode** link = &head;
+
+            for (size_t i = 0; i <= last; ++i)
+            {
+                if ((*link)->value == valueToRemove) {
+                    unlink(link, previous);
+                }
+                else
+                {
+                    previous = *link;
+                    link = &previous->next;
+                }
+            }
+
+            return true;
+        }
+
+        // Метод добавляет новый элемент в начало списка.
+        void pushFront(const T& value) {
+            emplaceFront(value);
+        }
+
+        void pushFront(T&& value) {
+            emplaceFront(std::move(value));
+        }
+
+        // Метод добавляет новый элемент в конец списка.
+        void pushBack(const T& value) {
+            emplaceBack(value);
+        }
+
+        void pushBack(T&& value) {
+            emplaceBack(std::move(value));
+        }
+
+        /*  Метод конструирует новый элемент в начале списка из аргументов args за O(1)
+            (новый узел ссылается на прежнюю голову, даже если она разделяемая).
+            Возвращает константную ссылку на созданный элемент.  */
+        template <typename... Args>
+        const T& emplaceFront(Args&&... args)
+        {
+            SharedNode* newNode = createNode(std::forward<Args>(args)...);
+
+            // Ссылка списка на прежнюю голову переходит к новому узлу.
+            newNode->next = head;
+
+            if (head == nullptr) {
+                tail = newNode;
+            }
+
+            head = newNode;
+            ++sizeOfList;
+
+            return newNode->value;
+        }
+
+        /*  Метод конструирует новый элемент в конце списка из аргументов args.
+            Сложность - O(1), если узлы списка не разделяются с другими списками, иначе - O(n)
+            (изменяется указатель в хвосте, поэтому вся цепочка копируется).
+            Возвращает константную ссылку на созданный элемент.  */
+        template <typename... Args>
+        const T& emplaceBack(Args&&... args)
+        {
+            SharedNode* newNode = createNode(std::forward<Args>(args)...);
+
+            try {
+                unsharePrefix(sizeOfList);
+            }
+            catch (...)
+            {
+                NodeTraits::destroy(allocator, newNode);
+                NodeTraits::deallocate(allocator, newNode, 1);
+                throw;
+            }
+
+            if (tail != nullptr) {
+                tail->next = newNode;
+            }
+            else {
+                head = newNode;
+            }
+
+            tail = newNode;
+            ++sizeOfList;
+
+            return newNode->value;
+        }
+
+        /*  Метод удаляет первый элемент из списка за O(1).
+            Возвращает значение удаленного элемента.  */
+        T popFront()
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            T deleted = takeValue(head);
+            unlink(&head, nullptr);
+
+            if (head == nullptr) {
+                maybeShared.store(false, std::memory_order_relaxed);
+            }
+
+            return deleted;
+        }
+
+        /*  Метод удаляет последний элемент из списка за O(n).
+            Возвращает значение удаленного элемента.  */
+        T popBack()
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            SharedNode* previous = unsharePrefix(sizeOfList - 1);
+            SharedNode** link = previous == nullptr ? &head : &previous->next;
+
+            T deleted = takeValue(*link);
+            unlink(link, previous);
+
+            if (head == nullptr) {
+                maybeShared.store(false, std::memory_order_relaxed);
+            }
+
+            return deleted;
+        }
+    };
+
+    template <typename Owner>
+    class IntrusiveListHook;
+
+    template <typename T, IntrusiveListHook<T> T::* Hook>
+    class IntrusiveLinkedList;
+
+    /*  IntrusiveListHook - связи, которые объект встраивает в себя, чтобы его можно было включить
+        в IntrusiveLinkedList без отдельного узла (Owner - тип объекта).
+        1.  Копия объекта получает несвязанное поле: связи не копируются и не переприсваиваются.
+        2.  При CONTAINERS_INTRUSIVE_CHECKS поле дополнительно помнит список, в который вставлен объект.  */
+    template <typename Owner>
+    class IntrusiveListHook
+    {
+    private:
+        template <typename T, IntrusiveListHook<T> T::*> friend class IntrusiveLinkedList;
+
+        Owner* next = nullptr;
+        Owner* previous = nullptr;
+
+#if CONTAINERS_INTRUSIVE_CHECKS
+        const void* list = nullptr;
+#endif
+
+    public:
+        IntrusiveListHook() = default;
+
+        IntrusiveListHook(const IntrusiveListHook&) noexcept {}
+
+        IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept {
+            return *this;
+        }
+    };
+
+    /*  IntrusiveLinkedList - шаблонный класс, описывающий список объектов, которыми владеет пользователь
+        (например, объектов из собственного пула). Объекты связываются через встроенное поле Hook
+        (IntrusiveListHook<T>), поэтому список ничего не выделяет, не копирует и не владеет элементами.
+        1.  Список двусвязный: удаление известного элемента (unlink()) и удаление с конца выполняются за O(1).
+        2.  Объект может находиться только в одном списке через одно поле; чтобы включать его в несколько
+        списков одновременно, в объекте заводится несколько полей IntrusiveListHook.
+        3.  При CONTAINERS_INTRUSIVE_CHECKS (по умолчанию - в сборке без NDEBUG) повторная вставка
+        элемента и удаление чужого элемента выбрасывают std::invalid_argument.
+        4.  Важно! Объект должен жить, пока он находится в списке. Разрушение списка отцепляет все элементы.  */
+    template <typename T, IntrusiveListHook<T> T::* Hook>
+    class IntrusiveLinkedList
+    {
+    private:
+        // Указатели на первый и последний элементы списка.
+        T* head;
+        T* tail;
+
+        // Размер списка на текущий момент.
+        size_t sizeOfList;
+
+        static IntrusiveListHook<T>& hookOf(T& element) noexcept {
+            return element.*Hook;
+        }
+
+        static const IntrusiveListHook<T>& hookOf(const T& element) noexcept {
+            return element.*Hook;
+        }
+
+        // Метод проверяет, что элемент не находится ни в одном списке, и помечает его как элемент нашего списка.
+        void attach(T& element)
+        {
+#if CONTAINERS_INTRUSIVE_CHECKS
+            if (hookOf(element).list != nullptr) {
+                throw std::invalid_argument("Error! The element is already linked into a list.");
+            }
+
+            hookOf(element).list = this;
+#else
+            (void)element;
+#endif
+        }
+
+        // Метод проверяет, что элемент находится в нашем списке.
+        void checkOwnership([[maybe_unused]] const T& element) const
+        {
+#if CONTAINERS_INTRUSIVE_CHECKS
+            if (hookOf(element).list != this) {
+                throw std::invalid_argument("Error! The element doesn't belong to this list.");
+            }
+#endif
+        }
+
+        // Метод вырезает элемент из цепочки и сбрасывает его связи (элемент можно снова вставить в список).
+        void detach(T& element) noexcept
+        {
+            IntrusiveListHook<T>& hook = hookOf(element);
+
+            if (hook.previous != nullptr) {
+                hookOf(*hook.previous).next = hook.next;
+            }
+            else {
+                head = hook.next;
+            }
+
+            if (hook.next != nullptr) {
+                hookOf(*hook.next).previous = hook.previous;
+            }
+            else {
+                tail = hook.previous;
+            }
+
+            hook.next = nullptr;
+            hook.previous = nullptr;
+
+#if CONTAINERS_INTRUSIVE_CHECKS
+            hook.list = nullptr;
+#endif
+
+            --sizeOfList;
+        }
+
+        // Метод переносит цепочку other в наш (пустой) список.
+        void takeChain(IntrusiveLinkedList& other) noexcept
+        {
+            head = other.head;
+            tail = other.tail;
+            sizeOfList = other.sizeOfList;
+
+#if CONTAINERS_INTRUSIVE_CHECKS
+            for (T* current = head; current != nullptr; current = hookOf(*current).next) {
+                hookOf(*current).list = this;
+            }
+#endif
+
+            other.head = nullptr;
+            other.tail = nullptr;
+            other.sizeOfList = 0;
+        }
+
+    public:
+        /*  BasicIterator - класс, описывающий структуру итератора (однонаправленного, как у LinkedList).
+            Iterator дает доступ к элементам на запись, ConstIterator - только на чтение.  */
+        template <bool IsConst>
+        class BasicIterator
+        {
+        private:
+            friend class IntrusiveLinkedList;
+
+            template <bool> friend class BasicIterator;
+
+            // Указатель на элемент, на который смотрит итератор.
+            T* element;
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<IsConst, const T*, T*>;
+            using reference = std::conditional_t<IsConst, const T&, T&>;
+
+            BasicIterator() : element(nullptr) {}
+
+            explicit BasicIterator(T* element) : element(element) {}
+
+            // Преобразование Iterator -> ConstIterator.
+            template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+            BasicIterator(const BasicIterator<OtherConst>& other) : element(other.element) {}
+
+            reference operator*() const {
+                return *element;
+            }
+
+            pointer operator->() const {
+                return element;
+            }
+
+            BasicIterator& operator++()
+            {
+                element = hookOf(*element).next;
+
+                if (element != nullptr) {
+                    CONTAINERS_PREFETCH(hookOf(*element).next);
+                }
+
+                return *this;
+            }
+
+            BasicIterator operator++(int)
+            {
+                BasicIterator previous = *this;
+                ++*this;
+                return previous;
+            }
+
+            template <bool OtherConst>
+            bool operator==(const BasicIterator<OtherConst>& other) const {
+                return element == other.element;
+            }
+
+            template <bool OtherConst>
+            bool operator!=(const BasicIterator<OtherConst>& other) const {
+                return element != other.element;
+            }
+        };
+
+        using Iterator = BasicIterator<false>;
+        using ConstIterator = BasicIterator<true>;
+
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = Iterator;
+        using const_iterator = ConstIterator;
+
+        Iterator begin() {
+            return Iterator(head);
+        }
+
+        ConstIterator begin() const {
+            return ConstIterator(head);
+        }
+
+        Iterator end() {
+            return Iterator(nullptr);
+        }
+
+        ConstIterator end() const {
+            return ConstIterator(nullptr);
+        }
+
+        ConstIterator cbegin() const {
+            return ConstIterator(head);
+        }
+
+        ConstIterator cend() const {
+            return ConstIterator(nullptr);
+        }
+
+        // Метод возвращает итератор на элемент element нашего списка за O(1).
+        Iterator iteratorTo(T& element)
+        {
+            checkOwnership(element);
+            return Iterator(&element);
+        }
+
+        IntrusiveLinkedList() : head(nullptr), tail(nullptr), sizeOfList(0) {}
+
+        // Объект может находиться только в одном списке, поэтому копирование запрещено.
+        IntrusiveLinkedList(const IntrusiveLinkedList&) = delete;
+        IntrusiveLinkedList& operator=(const IntrusiveLinkedList&) = delete;
+
+        // Перемещение забирает цепочку за O(1) (при CONTAINERS_INTRUSIVE_CHECKS - за O(n)).
+        IntrusiveLinkedList(IntrusiveLinkedList&& other) noexcept : IntrusiveLinkedList() {
+            takeChain(other);
+        }
+
+        IntrusiveLinkedList& operator=(IntrusiveLinkedList&& other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                takeChain(other);
+            }
+
+            return *this;
+        }
+
+        // Деструктор отцепляет все элементы (сами объекты не разрушаются).
+        ~IntrusiveLinkedList() {
+            clear();
+        }
+
+        bool isEmpty() const {
+            return head == nullptr;
+        }
+
+        size_t size() const {
+            return sizeOfList;
+        }
+
+        // Метод возвращает первый элемент списка по ссылке.
+        T& front() const
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the first element.");
+            }
+
+            return *head;
+        }
+
+        // Метод возвращает последний элемент списка по ссылке.
+        T& back() const
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the last element.");
+            }
+
+            return *tail;
+        }
+
+        // Метод вставляет элемент element в начало списка.
+        void pushFront(T& element)
+        {
+            attach(element);
+
+            IntrusiveListHook<T>& hook = hookOf(element);
+            hook.previous = nullptr;
+            hook.next = head;
+
+            if (head != nullptr) {
+                hookOf(*head).previous = &element;
+            }
+            else {
+                tail = &element;
+            }
+
+            head = &element;
+            ++sizeOfList;
+        }
+
+        // Метод вставляет элемент element в конец списка.
+        void pushBack(T& element)
+        {
+            attach(element);
+
+            IntrusiveListHook<T>& hook = hookOf(element);
+            hook.previous = tail;
+            hook.next = nullptr;
+
+            if (tail != nullptr) {
+                hookOf(*tail).next = &element;
+            }
+            else {
+                head = &element;
+            }
+
+            tail = &element;
+            ++sizeOfList;
+        }
+
+        // Метод вставляет элемент element сразу после элемента position нашего списка.
+        void insertAfter(T& position, T& element)
+        {
+            checkOwnership(position);
+            attach(element);
+
+            IntrusiveListHook<T>& hook = hookOf(element);
+            hook.previous = &position;
+            hook.next = hookOf(position).next;
+
+            if (hook.next != nullptr) {
+                hookOf(*hook.next).previous = &element;
+            }
+            else {
+                tail = &element;
+            }
+
+            hookOf(position).next = &element;
+            ++sizeOfList;
+        }
+
+        // Метод отцепляет первый элемент списка и возвращает его по ссылке.
+        T& popFront()
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            T& element = *head;
+            detach(element);
+            return element;
+        }
+
+        // Метод отцепляет последний элемент списка за O(1) и возвращает его по ссылке.
+        T& popBack()
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            T& element = *tail;
+            detach(element);
+            return element;
+        }
+
+        // Метод отцепляет элемент element нашего списка за O(1).
+        void unlink(T& element)
+        {
+            checkOwnership(element);
+            detach(element);
+        }
+
+        /*  Метод ищет первый элемент, равный value.
+            Возвращает указатель на него (nullptr - элемент не найден).  */
+        T* find(const T& value) const
+        {
+            for (T* current = head; current != nullptr; current = hookOf(*current).next)
+            {
+                if (*current == value) {
+                    return current;
+                }
+            }
+
+            return nullptr;
+        }
+
+        bool contains(const T& value) const {
+            return find(value) != nullptr;
+        }
+
+        /*  Метод отцепляет первый элемент, равный valueToRemove.
+            Возвращает true, если такой элемент был найден.  */
+        bool remove(const T& valueToRemove)
+        {
+            T* element = find(valueToRemove);
+
+            if (element == nullptr) {
+                return false;
+            }
+
+            detach(*element);
+            return true;
+        }
+
+        /*  Метод отцепляет все элементы, удовлетворяющие предикату predicate, за один проход.
+            Возвращает количество отцепленных элементов.  */
+        template <typename Predicate>
+        size_t removeIf(Predicate predicate)
+        {
+            const size_t oldSize = sizeOfList;
+
+            for (T* current = head; current != nullptr;)
+            {
+                T* next = hookOf(*current).next;
+
+                if (predicate(std::as_const(*current))) {
+                    detach(*current);
+                }
+
+                current = next;
+            }
+
+            return oldSize - sizeOfList;
+        }
+
+        // Метод отцепляет все элементы списка (их связи сбрасываются, и их можно снова вставить в список).
+        void clear() noexcept
+        {
+            for (T* current = head; current != nullptr;)
+            {
+                IntrusiveListHook<T>& hook = hookOf(*current);
+                current = hook.next;
+
+                hook.next = nullptr;
+                hook.previous = nullptr;
+
+#if CONTAINERS_INTRUSIVE_CHECKS
+                hook.list = nullptr;
+#endif
+            }
+
+            head = nullptr;
+            tail = nullptr;
+            sizeOfList = 0;
+        }
+    };
+
+    /*  EpochDomain - механизм безопасного освобождения памяти для lock-free контейнеров
+        (epoch-based reclamation).
+        1.  Поток, обращающийся к разделяемым узлам, находится внутри критической секции (объект Guard)
+        и объявляет глобальную эпоху, которую он наблюдал при входе.
+        2.  Исключенный из контейнера узел не освобождается сразу, а откладывается (retire) с пометкой
+        текущей эпохи. Глобальная эпоха увеличивается, только когда все активные потоки наблюдали ее текущее значение.
+        3.  Узел, отложенный в эпоху e, освобождается, когда глобальная эпоха достигает e + 2: к этому моменту
+        ни один поток гарантированно не может держать на него указатель.
+        4.  Домен один на процесс (EpochDomain::instance()), записи потоков переиспользуются после их завершения.  */
+    class EpochDomain
+    {
+    private:
+        // Retired - отложенный объект и функция, которая его освободит.
+        struct Retired
+        {
+            void* pointer;
+            void (*deleter)(void*);
+            std::uint64_t epoch;
+        };
+
+        // ThreadRecord - запись потока: объявленная эпоха и список отложенных им объектов.
+        struct ThreadRecord
+        {
+            // 0 - поток вне критической секции, иначе (эпоха << 1) | 1.
+            std::atomic<std::uint64_t> state{0};
+
+            // Занята ли запись каким-либо потоком.
+            std::atomic<bool> inUse{true};
+
+            // Следующая запись в списке записей домена (список только растет).
+            ThreadRecord* next = nullptr;
+
+            // Глубина вложенности критических секций потока.
+            unsigned nesting = 0;
+
+            // Объекты, отложенные потоком.
+            std::vector<Retired> retired;
+        };
+
+        // RecordHolder - владелец записи текущего потока (освобождает ее при завершении потока).
+        struct RecordHolder
+        {
+            ThreadRecord* record = nullptr;
+
+            ~RecordHolder()
+            {
+                if (record != nullptr)
+                {
+                    instance().reclaim(*record);
+                    record->inUse.store(false, std::memory_order_release);
+                }
+            }
+        };
+
+        // Количество отложенных объектов, после которого поток пытается продвинуть эпоху и освободить память.
+        static constexpr size_t reclaimThreshold = 64;
+
+        // Глобальная эпоха.
+        alignas(64) std::atomic<std::uint64_t> globalEpoch{1};
+
+        // Список записей всех потоков.
+        alignas(64) std::atomic<ThreadRecord*> records{nullptr};
+
+        EpochDomain() = default;
+
+        // Метод возвращает запись текущего потока (при первом обращении занимает свободную или создает новую).
+        ThreadRecord& currentRecord()
+        {
+            thread_local RecordHolder holder;
+
+            if (holder.record != nullptr) {
+                return *holder.record;
+            }
+
+            // 1. Пытаюсь занять запись завершившегося потока.
+            for (ThreadRecord* record = records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+            {
+                bool expected = false;
+
+                if (!record->inUse.load(std::memory_order_relaxed) &&
+                    record->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                {
+                    holder.record = record;
+                    return *record;
+                }
+            }
+
+            // 2. Свободных записей нет - добавляю новую в начало списка.
+            ThreadRecord* record = new ThreadRecord();
+            ThreadRecord* first = records.load(std::memory_order_relaxed);
+
+            do {
+                record->next = first;
+            } while (!records.compare_exchange_weak(first, record, std::memory_order_release, std::memory_order_relaxed));
+
+            holder.record = record;
+            return *record;
+        }
+
+        // Метод увеличивает глобальную эпоху, если все активные потоки уже наблюдали ее текущее значение.
+        void tryAdvance()
+        {
+            std::uint64_t epoch = globalEpoch.load(std::memory_order_seq_cst);
+
+            for (ThreadRecord* record = records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+            {
+                const std::uint64_t state = record->state.load(std::memory_order_seq_cst);
+
+                if ((state & 1) != 0 && (state >> 1) != epoch) {
+                    return;
+                }
+            }
+
+            globalEpoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+        }
+
+        // Метод освобождает отложенные потоком объекты, которые уже никто не может видеть.
+        void reclaim(ThreadRecord& record)
+        {
+            const std::uint64_t epoch = globalEpoch.load(std::memory_order_seq_cst);
+
+            auto isSafe = [epoch](const Retired& retired) { return retired.epoch + 2 <= epoch; };
+            auto firstUnsafe = std::partition(record.retired.begin(), record.retired.end(), isSafe);
+
+            for (auto it = record.retired.begin(); it != firstUnsafe; ++it) {
+                it->deleter(it->pointer);
+            }
+
+            record.retired.erase(record.retired.begin(), firstUnsafe);
+        }
+
+    public:
+        EpochDomain(const EpochDomain&) = delete;
+        EpochDomain& operator=(const EpochDomain&) = delete;
+
+        // При завершении программы освобождаю все, что осталось отложенным (других потоков к этому моменту нет).
+        ~EpochDomain()
+        {
+            ThreadRecord* record = records.load(std::memory_order_acquire);
+
+            while (record != nullptr)
+            {
+                for (const Retired& retired : record->retired) {
+                    retired.deleter(retired.pointer);
+                }
+
+                ThreadRecord* next = record->next;
+                delete record;
+                record = next;
+            }
+        }
+
+        // Метод возвращает домен процесса.
+        static EpochDomain& instance()
+        {
+            static EpochDomain domain;
+            return domain;
+        }
+
+        // Guard - критическая секция: пока объект жив, отложенные другими потоками узлы не будут освобождены.
+        class Guard
+        {
+        private:
+            ThreadRecord& record;
+
+        public:
+            Guard() : record(instance().currentRecord())
+            {
+                if (record.nesting++ == 0)
+                {
+                    const std::uint64_t epoch = instance().globalEpoch.load(std::memory_order_seq_cst);
+                    record.state.store((epoch << 1) | 1, std::memory_order_seq_cst);
+
+                    // Объявление эпохи должно стать видимым до чтения разделяемых указателей.
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                }
+            }
+
+            Guard(const Guard&) = delete;
+            Guard& operator=(const Guard&) = delete;
+
+            ~Guard()
+            {
+                if (--record.nesting == 0) {
+                    record.state.store(0, std::memory_order_release);
+                }
+            }
+        };
+
+        /*  Метод откладывает освобождение объекта pointer (его освободит вызов deleter(pointer)).
+            Вызывается после того, как объект стал недостижим для новых читателей.  */
+        void retire(void* pointer, void (*deleter)(void*))
+        {
+            ThreadRecord& record = currentRecord();
+            record.retired.push_back(Retired{pointer, deleter, globalEpoch.load(std::memory_order_seq_cst)});
+
+            if (record.retired.size() >= reclaimThreshold)
+            {
+                tryAdvance();
+                reclaim(record);
+            }
+        }
+    };
+
+    /*  ConcurrentQueue - шаблонный класс, описывающий lock-free очередь для многих производителей
+        и многих потребителей (алгоритм Майкла - Скотта).
+        1.  Модель та же, что у LinkedList, используемого как очередь: производители вызывают pushBack(),
+        потребители - tryPopFront(). Узлы образуют однонаправленный список с фиктивной головой.
+        2.  Исключенные узлы освобождаются через EpochDomain, поэтому потребитель никогда
+        не обращается к уже освобожденной памяти.
+        3.  pushBackBulk() публикует целую цепочку узлов одной атомарной операцией,
+        а tryPopFrontBulk() забирает несколько элементов за один вход в критическую секцию.
+        4.  Извлеченный узел уже отсоединен от очереди, поэтому перемещение значения из него не должно
+        выбрасывать исключений (иначе элемент был бы потерян) - это проверяется при компиляции.  */
+    template <typename T>
+    class ConcurrentQueue
+    {
+    private:
+        static_assert(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>,
+                      "ConcurrentQueue requires a T whose move assignment and destructor don't throw.");
+
+        // QueueNode - cтруктура узла. Значение конструируется в storage при добавлении и разрушается при извлечении.
+        struct QueueNode
+        {
+            // Указатель на следующий узел очереди.
+            std::atomic<QueueNode*> next{nullptr};
+
+            // Память под значение.
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            T& value() {
+                return *std::launder(reinterpret_cast<T*>(storage));
+            }
+        };
+
+        // Указатель на фиктивный узел (значение первого элемента хранится в узле, следующем за ним).
+        alignas(64) std::atomic<QueueNode*> head;
+
+        // Указатель на последний (или почти последний) узел очереди.
+        alignas(64) std::atomic<QueueNode*> tail;
+
+        // Функция освобождения узла для EpochDomain (значение к этому моменту уже разрушено).
+        static void deleteNode(void* node) {
+            delete static_cast<QueueNode*>(node);
+        }
+
+        // Метод создает узел со значением, сконструированным из аргументов args.
+        template <typename... Args>
+        static QueueNode* createNode(Args&&... args)
+        {
+            QueueNode* node = new QueueNode();
+
+            try {
+                ::new (static_cast<void*>(node->storage)) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                delete node;
+                throw;
+            }
+
+            return node;
+        }
+
+        // Метод присоединяет к концу очереди готовую цепочку узлов [first, last].
+        void linkChain(QueueNode* first, QueueNode* last)
+        {
+            EpochDomain::Guard guard;
+
+            while (true)
+            {
+                QueueNode* currentTail = tail.load(std::memory_order_acquire);
+                QueueNode* next = currentTail->next.load(std::memory_order_acquire);
+
+                if (currentTail != tail.load(std::memory_order_acquire)) {
+                    continue;
+                }
+
+                // 1. Хвост действительно последний - пытаюсь подвесить цепочку после него.
+                if (next == nullptr)
+                {
+                    if (currentTail->next.compare_exchange_weak(next, first, std::memory_order_release, std::memory_order_relaxed))
+                    {
+                        // 2. Передвигаю хвост (если не получилось - его уже передвигает другой поток).
+                        tail.compare_exchange_strong(currentTail, last, std::memory_order_release, std::memory_order_relaxed);
+                        return;
+                    }
+                }
+                else {
+                    // Хвост отстал - помогаю его передвинуть.
+                    tail.compare_exchange_weak(currentTail, next, std::memory_order_release, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /*  Метод отсоединяет первый элемент очереди и возвращает узел, значение которого теперь
+            принадлежит вызывающему (nullptr, если очередь пуста). Должен вызываться внутри критической секции.  */
+        QueueNode* detachFront()
+        {
+            while (true)
+            {
+                QueueNode* currentHead = head.load(std::memory_order_acquire);
+                QueueNode* currentTail = tail.load(std::memory_order_acquire);
+                QueueNode* next = currentHead->next.load(std::memory_order_acquire);
+
+                if (currentHead != head.load(std::memory_order_acquire)) {
+                    continue;
+                }
+
+                // 1. За фиктивным узлом ничего нет - очередь пуста.
+                if (next == nullptr) {
+                    return nullptr;
+                }
+
+                // 2. Хвост отстал от головы - помогаю его передвинуть.
+                if (currentHead == currentTail)
+                {
+                    tail.compare_exchange_weak(currentTail, next, std::memory_order_release, std::memory_order_relaxed);
+                    continue;
+                }
+
+                /* 3.   Передвигаю голову: узел next становится новым фиктивным узлом, а его значение
+                        принадлежит только этому потоку. Старый фиктивный узел откладываю на освобождение
+                        (next не будет освобожден, пока поток находится в критической секции).  */
+                if (head.compare_exchange_weak(currentHead, next, std::memory_order_acq_rel, std::memory_order_relaxed))
+                {
+                    EpochDomain::instance().retire(currentHead, &deleteNode);
+                    return next;
+                }
+            }
+        }
+
+        // Метод перемещает значение отсоединенного узла в out и разрушает его (исключений не бывает, см. static_assert).
+        static void takeValue(QueueNode* node, T& out) noexcept
+        {
+            out = std::move(node->value());
+            node->value().~T();
+        }
+
+    public:
+        ConcurrentQueue()
+        {
+            QueueNode* dummy = new QueueNode();
+            head.store(dummy, std::memory_order_relaxed);
+            tail.store(dummy, std::memory_order_relaxed);
+        }
+
+        ConcurrentQueue(const ConcurrentQueue&) = delete;
+        ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+
+        // Деструктор (к моменту уничтожения очереди других потоков, работающих с ней, быть не должно).
+        ~ConcurrentQueue()
+        {
+            QueueNode* current = head.load(std::memory_order_relaxed);
+            QueueNode* next = current->next.load(std::memory_order_relaxed);
+
+            // Фиктивный узел значения не содержит, остальные - содержат.
+            delete current;
+
+            while (next != nullptr)
+            {
+                current = next;
+                next = current->next.load(std::memory_order_relaxed);
+
+                current->value().~T();
+                delete current;
+            }
+        }
+
+        /*  Метод показывает, была ли очередь пустой в момент вызова.
+            Важно! При конкурентной работе результат может устареть сразу после возврата.  */
+        bool isEmpty() const
+        {
+            EpochDomain::Guard guard;
+            return head.load(std::memory_order_acquire)->next.load(std::memory_order_acquire) == nullptr;
+        }
+
+        // Метод добавляет элемент в конец очереди.
+        void pushBack(const T& value) {
+            emplaceBack(value);
+        }
+
+        void pushBack(T&& value) {
+            emplaceBack(std::move(value));
+        }
+
+        // Метод конструирует элемент в конце очереди из аргументов args.
+        template <typename... Args>
+        void emplaceBack(Args&&... args)
+        {
+            QueueNode* node = createNode(std::forward<Args>(args)...);
+            linkChain(node, node);
+        }
+
+        /*  Метод добавляет в конец очереди все элементы диапазона [first, last).
+            Элементы предварительно связываются в цепочку и публикуются одной атомарной операцией,
+            поэтому они идут в очереди подряд, в исходном порядке.  */
+        template <typename InputIterator>
+        void pushBackBulk(InputIterator first, InputIterator last)
+        {
+            QueueNode* chainHead = nullptr;
+            QueueNode* chainTail = nullptr;
+
+            // 1. Строю приватную цепочку (если конструктор выбросит исключение - освобождаю ее).
+            try
+            {
+                for (; first != last; ++first)
+                {
+                    QueueNode* node = createNode(*first);
+
+                    if (chainTail == nullptr) {
+                        chainHead = node;
+                    }
+                    else {
+                        chainTail->next.store(node, std::memory_order_relaxed);
+                    }
+
+                    chainTail = node;
+                }
+            }
+            catch (...)
+            {
+                while (chainHead != nullptr)
+                {
+                    QueueNode* next = chainHead->next.load(std::memory_order_relaxed);
+                    chainHead->value().~T();
+                    delete chainHead;
+                    chainHead = next;
+                }
+
+                throw;
+            }
+
+            // 2. Публикую цепочку.
+            if (chainHead != nullptr) {
+                linkChain(chainHead, chainTail);
+            }
+        }
+
+        /*  Метод извлекает первый элемент очереди в out.
+            Возвращает false, если очередь пуста (out при этом не изменяется).  */
+        bool tryPopFront(T& out)
+        {
+            EpochDomain::Guard guard;
+            QueueNode* node = detachFront();
+
+            if (node == nullptr) {
+                return false;
+            }
+
+            takeValue(node, out);
+            return true;
+        }
+
+        /*  Метод извлекает до maxCount первых элементов очереди и записывает их в output
+            (за один вход в критическую секцию). Возвращает количество извлеченных элементов.
+            Важно! Если запись в output выбросит исключение (например, std::back_inserter не смог
+            выделить память), извлекаемый в этот момент элемент теряется - память под результат
+            лучше зарезервировать заранее.  */
+        template <typename OutputIterator>
+        size_t tryPopFrontBulk(OutputIterator output, size_t maxCount)
+        {
+            EpochDomain::Guard guard;
+            size_t count = 0;
+
+            while (count < maxCount)
+            {
+                QueueNode* node = detachFront();
+
+                if (node == nullptr) {
+                    break;
+                }
+
+                try {
+                    *output = std::move(node->value());
+                }
+                catch (...)
+                {
+                    node->value().~T();
+                    throw;
+                }
+
+                node->value().~T();
+                ++output;
+                ++count;
+            }
+
+            return count;
+        }
+    };
+
+    /*  ConcurrentOrderedSet - шаблонный класс, описывающий lock-free упорядоченное множество
+        на однонаправленном списке (алгоритм Харриса - Майкла).
+        1.  Узлы упорядочены по compare, одинаковых элементов нет. Модель та же, что у find() / contains() /
+        remove() отсортированного LinkedList: поиск идет от головы до первого элемента, не меньшего искомого.
+        2.  Удаление двухфазное: сначала в указателе next удаляемого узла ставится метка (младший бит) -
+        узел логически удален, и вставить после него уже нельзя. Затем узел вырезается из цепочки:
+        самим удаляющим потоком или любым потоком, который встретит помеченный узел при поиске.
+        3.  contains() и find() - wait-free: они ничего не изменяют и проходят список один раз.
+        insert() и remove() - lock-free: неудачная CAS-операция означает, что другой поток продвинулся.
+        4.  Вырезанные узлы освобождаются через EpochDomain, поэтому поток, стоящий на узле, никогда
+        не обращается к освобожденной памяти.
+        5.  size() и isEmpty() при конкурентной работе показывают лишь состояние на момент вызова.  */
+    template <typename T, typename Compare = std::less<T>>
+    class ConcurrentOrderedSet
+    {
+    private:
+        // Указатель на следующий узел с меткой удаления в младшем бите.
+        using Link = std::atomic<std::uintptr_t>;
+
+        static constexpr std::uintptr_t deletedMark = 1;
+
+        // SetNode - cтруктура узла. Значение не изменяется после вставки (от него зависит порядок).
+        struct SetNode
+        {
+            const T value;
+            Link next{0};
+
+            template <typename... Args>
+            explicit SetNode(Args&&... args) : value(std::forward<Args>(args)...) {}
+        };
+
+        // Голова списка (указатель на первый узел; у головы метки не бывает).
+        alignas(64) Link head{0};
+
+        // Количество элементов (изменяется после успешных вставок и удалений).
+        alignas(64) std::atomic<size_t> count{0};
+
+        [[no_unique_address]] Compare compare;
+
+        static SetNode* nodeOf(std::uintptr_t link) noexcept {
+            return reinterpret_cast<SetNode*>(link & ~deletedMark);
+        }
+
+        static std::uintptr_t linkTo(const SetNode* node) noexcept {
+            return reinterpret_cast<std::uintptr_t>(node);
+        }
+
+        static bool isDeleted(std::uintptr_t link) noexcept {
+            return (link & deletedMark) != 0;
+        }
+
+        // Функция освобождения узла для EpochDomain.
+        static void deleteNode(void* node) {
+            delete static_cast<SetNode*>(node);
+        }
+
+        /*  Метод ищет место элемента value: previous - связь, указывающая на current, current - первый
+            непомеченный узел, не меньший value (nullptr - такого нет). Встреченные помеченные узлы вырезаются.
+            Возвращает true, если current равен value. Должен вызываться внутри критической секции.  */
+        bool search(const T& value, Link*& previous, SetNode*& current)
+        {
+            // Если связь, по которой я пришел к current, изменилась - поиск начинается с головы.
+            bool restart = true;
+
+            while (restart)
+            {
+                restart = false;
+                previous = &head;
+                current = nodeOf(previous->load(std::memory_order_acquire));
+
+                while (current != nullptr)
+                {
+                    const std::uintptr_t next = current->next.load(std::memory_order_acquire);
+
+                    // 1. current логически удален - вырезаю его.
+                    if (isDeleted(next))
+                    {
+                        std::uintptr_t expected = linkTo(current);
+
+                        if (!previous->compare_exchange_strong(expected, next & ~deletedMark,
+                                                               std::memory_order_acq_rel, std::memory_order_acquire))
+                        {
+                            restart = true;
+                            break;
+                        }
+
+                        EpochDomain::instance().retire(current, &deleteNode);
+                        current = nodeOf(next);
+                        continue;
+                    }
+
+                    // 2. Пока я читал next, предыдущий узел мог быть удален - тогда его связь уже не ведет к current.
+                    if (previous->load(std::memory_order_acquire) != linkTo(current))
+                    {
+                        restart = true;
+                        break;
+                    }
+
+                    // 3. Нашел первый узел, не меньший value.
+                    if (!compare(current->value, value)) {
+                        return !compare(value, current->value);
+                    }
+
+                    previous = &current->next;
+                    current = nodeOf(next);
+                }
+            }
+
+            return false;
+        }
+
+        // Метод возвращает первый непомеченный узел, не меньший value, не изменяя список (или nullptr).
+        const SetNode* lowerBound(const T& value) const
+        {
+            const SetNode* current = nodeOf(head.load(std::memory_order_acquire));
+
+            while (current != nullptr && compare(current->value, value)) {
+                current = nodeOf(current->next.load(std::memory_order_acquire));
+            }
+
+            return current;
+        }
+
+        // Метод показывает, хранит ли узел node (не помеченный как удаленный) элемент, равный value.
+        bool holds(const SetNode* node, const T& value) const
+        {
+            return node != nullptr && !compare(value, node->value) &&
+                   !isDeleted(node->next.load(std::memory_order_acquire));
+        }
+
+    public:
+        explicit ConcurrentOrderedSet(const Compare& compare = Compare()) : compare(compare) {}
+
+        ConcurrentOrderedSet(const ConcurrentOrderedSet&) = delete;
+        ConcurrentOrderedSet& operator=(const ConcurrentOrderedSet&) = delete;
+
+        // Деструктор (к моменту уничтожения множества других потоков, работающих с ним, быть не должно).
+        ~ConcurrentOrderedSet()
+        {
+            SetNode* current = nodeOf(head.load(std::memory_order_relaxed));
+
+            // Помеченные, но еще не вырезанные узлы тоже находятся в цепочке и принадлежат множеству.
+            while (current != nullptr)
+            {
+                SetNode* next = nodeOf(current->next.load(std::memory_order_relaxed));
+                delete current;
+                current = next;
+            }
+        }
+
+        /*  Метод показывает, сколько элементов было в множестве в момент вызова.
+            Важно! При конкурентной работе результат может устареть сразу после возврата.  */
+        size_t size() const {
+            return count.load(std::memory_order_relaxed);
+        }
+
+        bool isEmpty() const {
+            return size() == 0;
+        }
+
+        /*  Метод добавляет элемент, сконструированный из аргументов args, если равного ему в множестве нет.
+            Возвращает true, если элемент был добавлен.  */
+        template <typename... Args>
+        bool emplace(Args&&... args)
+        {
+            // 1. Узел создаю заранее: в цикле остаются только поиск и CAS.
+            std::unique_ptr<SetNode> node(new SetNode(std::forward<Args>(args)...));
+
+            EpochDomain::Guard guard;
+
+            while (true)
+            {
+                Link* previous;
+                SetNode* current;
+
+                // 2. Равный элемент уже есть - вставлять нечего.
+                if (search(node->value, previous, current)) {
+                    return false;
+                }
+
+                /* 3.   Подвешиваю узел перед current. CAS не пройдет, если связь previous изменилась:
+                        перед current вставили узел, current вырезали или previous помечен как удаленный.  */
+                node->next.store(linkTo(current), std::memory_order_relaxed);
+                std::uintptr_t expected = linkTo(current);
+
+                if (previous->compare_exchange_weak(expected, linkTo(node.get()), std::memory_order_release, std::memory_order_relaxed))
+                {
+                    node.release();
+                    count.fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+        }
+
+        bool insert(const T& value) {
+            return emplace(value);
+        }
+
+        bool insert(T&& value) {
+            return emplace(std::move(value));
+        }
+
+        /*  Метод удаляет элемент, равный value.
+            Возвращает true, если элемент был найден и удален этим вызовом.  */
+        bool remove(const T& value)
+        {
+            EpochDomain::Guard guard;
+
+            while (true)
+            {
+                Link* previous;
+                SetNode* current;
+
+                if (!search(value, previous, current)) {
+                    return false;
+                }
+
+                // 1. Логическое удаление: ставлю метку в next (если next изменился - повторяю поиск).
+                std::uintptr_t next = current->next.load(std::memory_order_acquire);
+
+                if (isDeleted(next) ||
+                    !current->next.compare_exchange_weak(next, next | deletedMark, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                    continue;
+                }
+
+                count.fetch_sub(1, std::memory_order_relaxed);
+
+                // 2. Физическое удаление: вырезаю узел сам, а если не вышло - поиск вырежет его по пути.
+                std::uintptr_t expected = linkTo(current);
+
+                if (previous->compare_exchange_strong(expected, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                    EpochDomain::instance().retire(current, &deleteNode);
+                }
+                else {
+                    search(value, previous, current);
+                }
+
+                return true;
+            }
+        }
+
+        /*  Метод проверяет, есть ли в множестве элемент, равный value (wait-free).
+            Возвращает соответствующее булевое значение.  */
+        bool contains(const T& value) const
+        {
+            EpochDomain::Guard guard;
+            return holds(lowerBound(value), value);
+        }
+
+        /*  Метод ищет элемент, равный value (wait-free), и возвращает его копию.
+            Ссылку вернуть нельзя: после выхода из метода узел может быть удален и освобожден.  */
+        std::optional<T> find(const T& value) const
+        {
+            EpochDomain::Guard guard;
+            const SetNode* node = lowerBound(value);
+
+            if (!holds(node, value)) {
+                return std::nullopt;
+            }
+
+            return node->value;
+        }
+
+        /*  Метод вызывает function(value) для элементов множества по возрастанию.
+            При конкурентных изменениях обход видит каждый элемент, который был в множестве все время обхода,
+            и не видит элементов, удаленных до его начала (как итераторы конкурентных контейнеров).  */
+        template <typename Function>
+        void forEach(Function function) const
+        {
+            EpochDomain::Guard guard;
+
+            for (const SetNode* current = nodeOf(head.load(std::memory_order_acquire)); current != nullptr;)
+            {
+                const std::uintptr_t next = current->next.load(std::memory_order_acquire);
+
+                if (!isDeleted(next)) {
+                    function(current->value);
+                }
+
+                current = nodeOf(next);
+            }
+        }
+    };
+}
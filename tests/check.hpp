@@ -0,0 +1,38 @@
+/*  check.hpp - минимальные средства для тестов из каталога tests/ (без внешних зависимостей).
+    1.  CHECK(condition) проверяет условие и в случае неудачи печатает файл, строку и текст условия;
+    проверки работают и при сборке с -DNDEBUG.
+    2.  Тест завершается кодом testExitCode(): 0, если все проверки прошли, иначе 1.  */
+#pragma once
+
+#include <cstdio>
+
+namespace tests
+{
+    inline int& failedChecks()
+    {
+        static int failed = 0;
+        return failed;
+    }
+
+    inline void reportFailure(const char* file, int line, const char* condition)
+    {
+        std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, condition);
+        ++failedChecks();
+    }
+
+    // Функция печатает итог теста name и возвращает код завершения процесса.
+    inline int testExitCode(const char* name)
+    {
+        if (failedChecks() == 0)
+        {
+            std::printf("%s: ok\n", name);
+            return 0;
+        }
+
+        std::printf("%s: %d check(s) failed\n", name, failedChecks());
+        return 1;
+    }
+}
+
+#define CHECK(condition) \
+    ((condition) ? static_cast<void>(0) : ::tests::reportFailure(__FILE__, __LINE__, #condition))
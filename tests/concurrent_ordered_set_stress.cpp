@@ -0,0 +1,322 @@
+/*  concurrent_ordered_set_stress.cpp - тесты ConcurrentOrderedSet.
+    1.  Дифференциальная проверка против std::set на случайной последовательности операций (один поток).
+    2.  Конкурентная нагрузка: 8 потоков вставляют и удаляют общие ключи, проверяют постоянные ключи
+    и "собственные" ключи, а отдельный читатель следит, что обход всегда упорядочен.
+    3.  Проверка линеаризуемости (алгоритм Винг - Гонг): история операций нескольких потоков над одним
+    ключом должна допускать последовательное выполнение, согласованное с интервалами операций.
+    Сборка и запуск из корня репозитория:
+        g++ -std=c++17 -O2 -pthread tests/concurrent_ordered_set_stress.cpp -o concurrent_ordered_set_stress
+        ./concurrent_ordered_set_stress  */
+#include "check.hpp"
+#include "../dream.cpp"
+
+#include <atomic>
+#include <climits>
+#include <cstdio>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Однопоточная проверка: результаты операций и содержимое совпадают с std::set.
+    void matchesStdSet()
+    {
+        Containers::ConcurrentOrderedSet<int> set;
+        std::set<int> reference;
+        std::mt19937 generator(1);
+
+        for (int i = 0; i < 20000; ++i)
+        {
+            const int key = static_cast<int>(generator() % 200);
+
+            switch (generator() % 3)
+            {
+                case 0:
+                    CHECK(set.insert(key) == reference.insert(key).second);
+                    break;
+
+                case 1:
+                    CHECK(set.remove(key) == (reference.erase(key) == 1));
+                    break;
+
+                default:
+                    CHECK(set.contains(key) == (reference.count(key) == 1));
+                    CHECK(set.find(key).has_value() == (reference.count(key) == 1));
+            }
+        }
+
+        std::vector<int> elements;
+        set.forEach([&elements](int value) { elements.push_back(value); });
+
+        CHECK(elements == std::vector<int>(reference.begin(), reference.end()));
+        CHECK(set.size() == reference.size());
+
+        // Пользовательский компаратор и emplace().
+        Containers::ConcurrentOrderedSet<std::string, std::greater<>> strings;
+        strings.emplace(3, 'a');
+        strings.insert("b");
+
+        CHECK(!strings.insert("aaa"));
+        CHECK(strings.size() == 2 && *strings.find("aaa") == "aaa");
+
+        std::string first;
+        strings.forEach([&first](const std::string& value) {
+            if (first.empty()) {
+                first = value;
+            }
+        });
+
+        CHECK(first == "b");
+    }
+
+    std::string keyName(int key)
+    {
+        char buffer[16];
+        std::snprintf(buffer, sizeof(buffer), "k%03d", key);
+        return buffer;
+    }
+
+    // Конкурентная нагрузка: итог каждого общего ключа равен сумме удачных вставок и удалений.
+    void survivesChurn()
+    {
+        const int threads = 8;
+        const int keys = 64;
+        const int operations = 40000;
+
+        Containers::ConcurrentOrderedSet<std::string> set;
+        std::vector<std::atomic<int>> balance(keys);
+        std::atomic<long> violations{0};
+        std::atomic<bool> stop{false};
+
+        // Постоянные ключи никто не удаляет.
+        for (int key = 1000; key < 1010; ++key) {
+            set.insert(keyName(key));
+        }
+
+        std::vector<std::thread> workers;
+
+        for (int thread = 0; thread < threads; ++thread)
+        {
+            workers.emplace_back([&, thread]() {
+                std::mt19937 generator(thread);
+                const std::string own = keyName(2000 + thread);
+
+                for (int i = 0; i < operations; ++i)
+                {
+                    const int key = static_cast<int>(generator() % keys);
+
+                    switch (generator() % 4)
+                    {
+                        case 0:
+                            if (set.insert(keyName(key))) {
+                                ++balance[key];
+                            }
+                            break;
+
+                        case 1:
+                            if (set.remove(keyName(key))) {
+                                --balance[key];
+                            }
+                            break;
+
+                        case 2:
+                            if (!set.contains(keyName(1000 + key % 10))) {
+                                ++violations;
+                            }
+                            break;
+
+                        default:
+                            // Собственный ключ трогает только этот поток.
+                            if (!set.insert(own) || !set.contains(own) || !set.remove(own) || set.contains(own) || set.remove(own)) {
+                                ++violations;
+                            }
+                    }
+                }
+            });
+        }
+
+        std::thread reader([&]() {
+            while (!stop.load())
+            {
+                std::string previous;
+                bool sorted = true;
+
+                set.forEach([&](const std::string& value) {
+                    if (!previous.empty() && !(previous < value)) {
+                        sorted = false;
+                    }
+
+                    previous = value;
+                });
+
+                if (!sorted) {
+                    ++violations;
+                }
+            }
+        });
+
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+
+        stop.store(true);
+        reader.join();
+
+        CHECK(violations.load() == 0);
+
+        size_t present = 10;
+
+        for (int key = 0; key < keys; ++key)
+        {
+            CHECK(balance[key] == 0 || balance[key] == 1);
+            CHECK(set.contains(keyName(key)) == (balance[key] == 1));
+            present += static_cast<size_t>(balance[key].load());
+        }
+
+        CHECK(set.size() == present);
+    }
+
+    // Операция над одним ключом: вид, результат и интервал [begin, end] по общим часам.
+    enum class Kind { Insert, Remove, Contains };
+
+    struct Operation
+    {
+        Kind kind;
+        bool result;
+        long begin;
+        long end;
+    };
+
+    long tick()
+    {
+        static std::atomic<long> clock{0};
+        return clock.fetch_add(1);
+    }
+
+    /*  Поиск Винг - Гонг: следующей линеаризуется любая невыполненная операция, начавшаяся раньше,
+        чем закончилась любая другая невыполненная, если ее результат согласован с состоянием ключа.  */
+    bool linearizable(const std::vector<Operation>& history, std::vector<bool>& done, bool present, size_t left)
+    {
+        if (left == 0) {
+            return true;
+        }
+
+        long earliestEnd = LONG_MAX;
+
+        for (size_t i = 0; i < history.size(); ++i)
+        {
+            if (!done[i]) {
+                earliestEnd = std::min(earliestEnd, history[i].end);
+            }
+        }
+
+        for (size_t i = 0; i < history.size(); ++i)
+        {
+            if (done[i] || history[i].begin > earliestEnd) {
+                continue;
+            }
+
+            const Operation& operation = history[i];
+            bool expected = present;
+            bool next = present;
+
+            if (operation.kind == Kind::Insert)
+            {
+                expected = !present;
+                next = true;
+            }
+            else if (operation.kind == Kind::Remove) {
+                next = false;
+            }
+
+            if (operation.result != expected) {
+                continue;
+            }
+
+            done[i] = true;
+
+            if (linearizable(history, done, next, left - 1)) {
+                return true;
+            }
+
+            done[i] = false;
+        }
+
+        return false;
+    }
+
+    // Короткие истории трех потоков над ключом 7; соседние ключи меняются, чтобы задеть вырезание узлов.
+    void isLinearizable()
+    {
+        const int rounds = 2000;
+        const size_t threads = 3;
+        int failures = 0;
+
+        for (int round = 0; round < rounds; ++round)
+        {
+            Containers::ConcurrentOrderedSet<int> set;
+
+            for (int key = 0; key < 20; key += 2) {
+                set.insert(key);
+            }
+
+            std::vector<std::vector<Operation>> histories(threads);
+            std::vector<std::thread> workers;
+
+            for (size_t thread = 0; thread < threads; ++thread)
+            {
+                workers.emplace_back([&, thread]() {
+                    std::mt19937 generator(static_cast<unsigned>(round * 7 + thread));
+
+                    for (int i = 0; i < 5; ++i)
+                    {
+                        Operation operation{static_cast<Kind>(generator() % 3), false, tick(), 0};
+
+                        switch (operation.kind)
+                        {
+                            case Kind::Insert: operation.result = set.insert(7); break;
+                            case Kind::Remove: operation.result = set.remove(7); break;
+                            case Kind::Contains: operation.result = set.contains(7); break;
+                        }
+
+                        operation.end = tick();
+                        histories[thread].push_back(operation);
+
+                        if (generator() % 2 != 0)
+                        {
+                            set.remove(8 + static_cast<int>(generator() % 2) * 2);
+                            set.insert(8);
+                        }
+                    }
+                });
+            }
+
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+
+            std::vector<Operation> history;
+
+            for (const auto& operations : histories) {
+                history.insert(history.end(), operations.begin(), operations.end());
+            }
+
+            std::vector<bool> done(history.size(), false);
+            failures += !linearizable(history, done, false, history.size());
+        }
+
+        CHECK(failures == 0);
+    }
+}
+
+int main()
+{
+    matchesStdSet();
+    survivesChurn();
+    isLinearizable();
+
+    return tests::testExitCode("concurrent_ordered_set_stress");
+}
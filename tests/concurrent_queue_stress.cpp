@@ -0,0 +1,213 @@
+/*  concurrent_queue_stress.cpp - стресс-тест ConcurrentQueue для многих производителей и многих потребителей.
+    Проверяется, что ни один элемент не потерян и не получен дважды, а элементы одного производителя
+    каждый потребитель получает в порядке их добавления (FIFO для каждого производителя).
+    Сборка и запуск из корня репозитория:
+        g++ -std=c++17 -O2 -pthread tests/concurrent_queue_stress.cpp -o concurrent_queue_stress
+        ./concurrent_queue_stress  */
+#include "check.hpp"
+#include "../dream.cpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Элемент очереди кодирует номер производителя (старшие 32 бита) и порядковый номер элемента.
+    std::uint64_t encode(size_t producer, size_t sequence) {
+        return (std::uint64_t(producer) << 32) | sequence;
+    }
+
+    // Преобразования элемента очереди: число хранится как есть или в куче (проверка разрушения значений).
+    struct Plain
+    {
+        using Value = std::uint64_t;
+
+        static Value make(std::uint64_t code) {
+            return code;
+        }
+
+        static std::uint64_t code(const Value& value) {
+            return value;
+        }
+    };
+
+    struct Boxed
+    {
+        using Value = std::unique_ptr<std::uint64_t>;
+
+        static Value make(std::uint64_t code) {
+            return std::make_unique<std::uint64_t>(code);
+        }
+
+        static std::uint64_t code(const Value& value) {
+            return *value;
+        }
+    };
+
+    /*  Функция запускает producers производителей и consumers потребителей на одной очереди.
+        Bulk == true - производители и потребители работают пачками (pushBackBulk / tryPopFrontBulk).  */
+    template <typename Element, bool Bulk>
+    void stress(size_t producers, size_t consumers, size_t perProducer)
+    {
+        using Value = typename Element::Value;
+
+        Containers::ConcurrentQueue<Value> queue;
+        std::atomic<size_t> consumed{0};
+        const size_t total = producers * perProducer;
+
+        // received[p][s] - сколько раз получен элемент s производителя p.
+        std::vector<std::vector<std::atomic<unsigned char>>> received(producers);
+
+        for (auto& counts : received) {
+            counts = std::vector<std::atomic<unsigned char>>(perProducer);
+        }
+
+        std::atomic<size_t> orderViolations{0};
+
+        auto produce = [&](size_t producer) {
+            if constexpr (Bulk)
+            {
+                const size_t batch = 16;
+                std::vector<Value> values;
+
+                for (size_t first = 0; first < perProducer; first += batch)
+                {
+                    values.clear();
+
+                    for (size_t s = first; s < std::min(perProducer, first + batch); ++s) {
+                        values.push_back(Element::make(encode(producer, s)));
+                    }
+
+                    queue.pushBackBulk(std::make_move_iterator(values.begin()), std::make_move_iterator(values.end()));
+                }
+            }
+            else
+            {
+                for (size_t s = 0; s < perProducer; ++s) {
+                    queue.pushBack(Element::make(encode(producer, s)));
+                }
+            }
+        };
+
+        auto consume = [&]() {
+            // Последний полученный этим потребителем порядковый номер каждого производителя (+1).
+            std::vector<size_t> nextExpected(producers, 0);
+            std::vector<Value> values;
+            values.reserve(32);
+
+            auto accept = [&](const Value& value) {
+                const std::uint64_t code = Element::code(value);
+                const size_t producer = size_t(code >> 32);
+                const size_t sequence = size_t(code & 0xFFFFFFFFu);
+
+                if (producer >= producers || sequence >= perProducer || sequence < nextExpected[producer]) {
+                    orderViolations.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+
+                nextExpected[producer] = sequence + 1;
+                received[producer][sequence].fetch_add(1, std::memory_order_relaxed);
+            };
+
+            while (consumed.load(std::memory_order_relaxed) < total)
+            {
+                size_t taken = 0;
+
+                if constexpr (Bulk)
+                {
+                    values.clear();
+                    taken = queue.tryPopFrontBulk(std::back_inserter(values), 32);
+
+                    for (const Value& value : values) {
+                        accept(value);
+                    }
+                }
+                else
+                {
+                    Value value{};
+
+                    if (queue.tryPopFront(value))
+                    {
+                        accept(value);
+                        taken = 1;
+                    }
+                }
+
+                if (taken == 0) {
+                    std::this_thread::yield();
+                }
+                else {
+                    consumed.fetch_add(taken, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+
+        for (size_t c = 0; c < consumers; ++c) {
+            threads.emplace_back(consume);
+        }
+
+        for (size_t p = 0; p < producers; ++p) {
+            threads.emplace_back(produce, p);
+        }
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        // Каждый элемент получен ровно один раз, порядок не нарушен, очередь пуста.
+        size_t missing = 0;
+        size_t duplicated = 0;
+
+        for (const auto& counts : received)
+        {
+            for (const auto& count : counts)
+            {
+                missing += count.load() == 0;
+                duplicated += count.load() > 1;
+            }
+        }
+
+        CHECK(consumed.load() == total);
+        CHECK(missing == 0);
+        CHECK(duplicated == 0);
+        CHECK(orderViolations.load() == 0);
+        CHECK(queue.isEmpty());
+    }
+
+    template <typename Element>
+    void runAll(size_t perProducer)
+    {
+        const size_t configurations[][2] = {{1, 1}, {1, 4}, {4, 1}, {4, 4}, {8, 3}};
+
+        for (const auto& configuration : configurations)
+        {
+            stress<Element, false>(configuration[0], configuration[1], perProducer);
+            stress<Element, true>(configuration[0], configuration[1], perProducer);
+        }
+    }
+}
+
+int main()
+{
+    runAll<Plain>(50000);
+    runAll<Boxed>(10000);
+
+    // Очередь, разрушаемая с оставшимися элементами, освобождает их.
+    {
+        Containers::ConcurrentQueue<std::unique_ptr<int>> queue;
+
+        for (int i = 0; i < 100; ++i) {
+            queue.pushBack(std::make_unique<int>(i));
+        }
+
+        std::unique_ptr<int> first;
+        CHECK(queue.tryPopFront(first) && *first == 0);
+    }
+
+    return tests::testExitCode("concurrent_queue_stress");
+}
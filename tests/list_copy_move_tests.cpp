@@ -0,0 +1,356 @@
+/*  list_copy_move_tests.cpp - проверка количества копирований и перемещений элементов в LinkedList.
+    Сборка и запуск из корня репозитория:
+        g++ -std=c++17 -O2 -pthread tests/list_copy_move_tests.cpp -o list_copy_move_tests
+        ./list_copy_move_tests  */
+#include "check.hpp"
+#include "../dream.cpp"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    // Counted - элемент, считающий свои конструирования, копирования, перемещения и разрушения.
+    struct Counted
+    {
+        static inline int constructions = 0;
+        static inline int copies = 0;
+        static inline int moves = 0;
+        static inline int destructions = 0;
+
+        int value;
+
+        explicit Counted(int value) : value(value) {
+            ++constructions;
+        }
+
+        Counted(int first, int second) : value(first * 100 + second) {
+            ++constructions;
+        }
+
+        Counted(const Counted& other) : value(other.value) {
+            ++copies;
+        }
+
+        Counted(Counted&& other) noexcept : value(other.value) {
+            ++moves;
+        }
+
+        Counted& operator=(const Counted& other)
+        {
+            value = other.value;
+            ++copies;
+            return *this;
+        }
+
+        Counted& operator=(Counted&& other) noexcept
+        {
+            value = other.value;
+            ++moves;
+            return *this;
+        }
+
+        ~Counted() {
+            ++destructions;
+        }
+
+        bool operator==(const Counted& other) const {
+            return value == other.value;
+        }
+
+        bool operator!=(const Counted& other) const {
+            return value != other.value;
+        }
+
+        static void reset() {
+            constructions = copies = moves = destructions = 0;
+        }
+
+        // Количество живых объектов.
+        static int alive() {
+            return constructions + copies + moves - destructions;
+        }
+    };
+
+    template <typename List>
+    void pushBackMovesTheValue()
+    {
+        Counted::reset();
+        {
+            List list;
+            Counted value(1);
+
+            list.pushBack(std::move(value));
+            list.pushFront(Counted(2));
+
+            CHECK(Counted::copies == 0);
+            CHECK(Counted::moves == 2);
+            CHECK(list.front().value == 2 && list.back().value == 1);
+
+            // Копирующая версия копирует ровно один раз.
+            list.pushBack(value);
+            CHECK(Counted::copies == 1);
+        }
+        CHECK(Counted::alive() == 0);
+    }
+
+    template <typename List>
+    void emplaceConstructsInPlace()
+    {
+        Counted::reset();
+        {
+            List list;
+
+            Counted& back = list.emplaceBack(1, 2);
+            Counted& front = list.emplaceFront(3);
+
+            CHECK(Counted::constructions == 2);
+            CHECK(Counted::copies == 0 && Counted::moves == 0);
+            CHECK(back.value == 102 && front.value == 3);
+            CHECK(&list.back() == &back && &list.front() == &front);
+        }
+        CHECK(Counted::alive() == 0);
+    }
+
+    template <typename List>
+    void popMovesTheValueOut()
+    {
+        Counted::reset();
+        {
+            List list;
+            list.emplaceBack(1);
+            list.emplaceBack(2);
+            list.emplaceBack(3);
+
+            Counted first = list.popFront();
+            Counted last = list.popBack();
+
+            CHECK(first.value == 1 && last.value == 3);
+            CHECK(Counted::copies == 0);
+
+            // Одно перемещение из узла на каждый pop (возврат значения - copy elision).
+            CHECK(Counted::moves == 2);
+            CHECK(list.size() == 1 && list.front().value == 2);
+        }
+        CHECK(Counted::alive() == 0);
+    }
+
+    template <typename List>
+    void initializerListCopiesOnce()
+    {
+        Counted::reset();
+        {
+            const std::initializer_list<Counted> values{Counted(1), Counted(2), Counted(3)};
+            Counted::reset();
+
+            List list(values);
+
+            // Элементы initializer_list константны: каждый копируется в узел ровно один раз.
+            CHECK(Counted::copies == 3);
+            CHECK(Counted::moves == 0);
+            CHECK(list.size() == 3 && list.front().value == 1 && list.back().value == 3);
+        }
+        CHECK(Counted::destructions == 6);
+    }
+
+    template <typename List>
+    void copyConstructorCopiesOnce()
+    {
+        Counted::reset();
+        {
+            List original;
+
+            for (int i = 0; i < 5; ++i) {
+                original.emplaceBack(i);
+            }
+
+            List copy(original);
+
+            CHECK(Counted::copies == 5);
+            CHECK(Counted::moves == 0);
+            CHECK(std::equal(copy.begin(), copy.end(), original.begin(), original.end()));
+
+            // Перемещение списка не трогает элементы, размещенные в куче.
+            const int movesBefore = Counted::moves;
+            List moved(std::move(copy));
+
+            CHECK(Counted::copies == 5);
+            CHECK(moved.size() == 5 && copy.isEmpty());
+
+            if constexpr (std::is_same_v<List, Containers::LinkedList<Counted>>) {
+                CHECK(Counted::moves == movesBefore);
+            }
+        }
+        CHECK(Counted::alive() == 0);
+    }
+
+    // Строки перемещаются без копирования буфера.
+    void stringsAreNotCopied()
+    {
+        Containers::LinkedList<std::string> list;
+        std::string value(100, 'x');
+        const char* buffer = value.data();
+
+        list.pushBack(std::move(value));
+        CHECK(list.back().data() == buffer);
+
+        std::string popped = list.popBack();
+        CHECK(popped.data() == buffer);
+    }
+
+    // HashedLinkedList перемещает значение из узла при pop (в том числе для типов без копирования).
+    void hashedPopMovesTheValueOut()
+    {
+        Containers::HashedLinkedList<std::unique_ptr<int>> list;
+        std::unique_ptr<int> first = std::make_unique<int>(1);
+        std::unique_ptr<int> last = std::make_unique<int>(3);
+        const int* firstAddress = first.get();
+        const int* lastAddress = last.get();
+
+        list.pushBack(std::move(first));
+        list.pushBack(std::make_unique<int>(2));
+        list.pushBack(std::move(last));
+
+        std::unique_ptr<int> poppedFirst = list.popFront();
+        std::unique_ptr<int> poppedLast = list.popBack();
+
+        CHECK(poppedFirst.get() == firstAddress && *poppedFirst == 1);
+        CHECK(poppedLast.get() == lastAddress && *poppedLast == 3);
+        CHECK(list.size() == 1 && *list.front() == 2);
+        CHECK(!list.contains(poppedFirst) && !list.contains(poppedLast));
+        CHECK(list.contains(list.front()));
+
+        Containers::HashedLinkedList<std::string> strings;
+        strings.pushBack(std::string(100, 'x'));
+        const char* buffer = strings.back().data();
+
+        std::string popped = strings.popBack();
+        CHECK(popped.data() == buffer);
+        CHECK(strings.isEmpty() && !strings.contains(popped));
+    }
+
+    // ThrowingMove - элемент, чье перемещение выбрасывает исключение на заданном по счету перемещении.
+    struct ThrowingMove
+    {
+        static inline int movesUntilThrow = -1;
+
+        int value;
+
+        explicit ThrowingMove(int value) : value(value) {}
+
+        ThrowingMove(const ThrowingMove& other) = default;
+
+        ThrowingMove(ThrowingMove&& other) : value(other.value)
+        {
+            if (movesUntilThrow > 0 && --movesUntilThrow == 0) {
+                throw std::runtime_error("move failed");
+            }
+        }
+
+        ThrowingMove& operator=(const ThrowingMove& other) = default;
+
+        bool operator==(const ThrowingMove& other) const {
+            return value == other.value;
+        }
+    };
+
+    struct ThrowingMoveHash
+    {
+        size_t operator()(const ThrowingMove& element) const {
+            return std::hash<int>()(element.value);
+        }
+    };
+
+    /*  Если перемещение значения при popFront/popBack выбрасывает исключение (первое перемещение - из узла,
+        следующие - в место возврата), элемент все равно удаляется ровно один раз, а список и индекс
+        остаются согласованными.  */
+    void hashedPopSurvivesThrowingMove()
+    {
+        using List = Containers::HashedLinkedList<ThrowingMove, ThrowingMoveHash>;
+
+        for (int throwAt = 1; throwAt <= 3; ++throwAt)
+        {
+            for (bool fromFront : {true, false})
+            {
+                List list;
+                list.pushBack(ThrowingMove(1));
+                list.pushBack(ThrowingMove(2));
+                list.pushBack(ThrowingMove(3));
+
+                const int removed = fromFront ? 1 : 3;
+                bool threw = false;
+                ThrowingMove::movesUntilThrow = throwAt;
+
+                try
+                {
+                    ThrowingMove popped = fromFront ? list.popFront() : list.popBack();
+                    CHECK(popped.value == removed);
+                }
+                catch (const std::runtime_error&) {
+                    threw = true;
+                }
+
+                ThrowingMove::movesUntilThrow = -1;
+                CHECK(throwAt != 1 || threw);
+
+                CHECK(list.size() == 2);
+                CHECK(!list.contains(ThrowingMove(removed)));
+                CHECK(list.contains(ThrowingMove(2)));
+                CHECK(list.front().value == (fromFront ? 2 : 1));
+                CHECK(list.back().value == (fromFront ? 3 : 2));
+
+                // Список остается пригодным для дальнейшей работы.
+                CHECK(list.popFront().value == (fromFront ? 2 : 1));
+                CHECK(list.popBack().value == (fromFront ? 3 : 2));
+                CHECK(list.isEmpty());
+            }
+        }
+    }
+
+    // Перемещение HashedLinkedList не выбрасывает исключений, поэтому std::vector при росте перемещает списки.
+    void hashedListsAreMovedOnGrowth()
+    {
+        using List = Containers::HashedLinkedList<int>;
+
+        static_assert(std::is_nothrow_move_constructible_v<List>);
+        static_assert(std::is_nothrow_move_assignable_v<List>);
+
+        std::vector<List> lists(1);
+        lists[0].pushBack(1);
+        lists[0].pushBack(2);
+        const int* first = &lists[0].front();
+
+        for (size_t i = 0; i < 64; ++i) {
+            lists.emplace_back();
+        }
+
+        // Узлы не копировались: элемент остался по тому же адресу, индекс переехал вместе с ними.
+        CHECK(&lists[0].front() == first);
+        CHECK(lists[0].size() == 2 && lists[0].contains(1) && lists[0].contains(2));
+    }
+
+    template <typename List>
+    void runAll()
+    {
+        pushBackMovesTheValue<List>();
+        emplaceConstructsInPlace<List>();
+        popMovesTheValueOut<List>();
+        initializerListCopiesOnce<List>();
+        copyConstructorCopiesOnce<List>();
+    }
+}
+
+int main()
+{
+    runAll<Containers::LinkedList<Counted>>();
+    runAll<Containers::SmallLinkedList<Counted, 4>>();
+    stringsAreNotCopied();
+    hashedPopMovesTheValueOut();
+    hashedPopSurvivesThrowingMove();
+    hashedListsAreMovedOnGrowth();
+
+    return tests::testExitCode("list_copy_move_tests");
+}
@@ -0,0 +1,155 @@
+/*  list_serialization_tests.cpp - проверка двоичного формата LinkedList::saveTo() / loadFrom() и MappedListView.
+    1.  Файл списка одного типа элементов не загружается в список другого типа того же размера.
+    2.  Испорченный заголовок отклоняется до очистки списка: loadFrom() выбрасывает исключение,
+    а содержимое списка не изменяется.
+    Сборка и запуск из корня репозитория:
+        g++ -std=c++17 -O2 -pthread tests/list_serialization_tests.cpp -o list_serialization_tests
+        ./list_serialization_tests  */
+#include "check.hpp"
+#include "../dream.cpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    using Containers::ListFileHeader;
+
+    // Функция возвращает содержимое файла списка list (формат saveTo()).
+    template <typename List>
+    std::string serialize(const List& list)
+    {
+        std::ostringstream out(std::ios::binary);
+        list.saveTo(out);
+        return out.str();
+    }
+
+    // Функция возвращает копию данных data, в заголовке которой поле изменено функцией corrupt.
+    std::string withHeader(std::string data, const std::function<void(ListFileHeader&)>& corrupt)
+    {
+        ListFileHeader header(Containers::ElementKind::Unspecified, 0, 0);
+        std::memcpy(&header, data.data(), sizeof(header));
+        corrupt(header);
+        std::memcpy(&data[0], &header, sizeof(header));
+        return data;
+    }
+
+    // Функция проверяет, что загрузка data выбрасывает исключение Exception и не изменяет list.
+    template <typename Exception, typename List>
+    void checkRejected(List& list, const std::string& data)
+    {
+        const List before(list);
+        std::istringstream in(data, std::ios::binary);
+
+        try
+        {
+            list.loadFrom(in);
+            CHECK(false);
+        }
+        catch (const Exception&) {}
+
+        CHECK(list.size() == before.size());
+        CHECK(std::equal(list.begin(), list.end(), before.begin(), before.end()));
+    }
+
+    // Список сохраняется и загружается без изменений (тривиально копируемые значения и строки).
+    void roundTrip()
+    {
+        const Containers::LinkedList<int> numbers{1, -2, 3};
+        Containers::LinkedList<int> loadedNumbers{42};
+        std::istringstream numbersIn(serialize(numbers), std::ios::binary);
+        loadedNumbers.loadFrom(numbersIn);
+        CHECK(std::equal(loadedNumbers.begin(), loadedNumbers.end(), numbers.begin(), numbers.end()));
+
+        const Containers::LinkedList<std::string> strings{"one", "", std::string(1000, 'x')};
+        Containers::LinkedList<std::string> loadedStrings;
+        std::istringstream stringsIn(serialize(strings), std::ios::binary);
+        loadedStrings.loadFrom(stringsIn);
+        CHECK(std::equal(loadedStrings.begin(), loadedStrings.end(), strings.begin(), strings.end()));
+    }
+
+    // Файл с элементами другого вида того же размера отклоняется.
+    void otherElementTypeIsRejected()
+    {
+        const std::string ints = serialize(Containers::LinkedList<int>{1, 2, 3});
+
+        Containers::LinkedList<float> floats{0.5f};
+        checkRejected<std::runtime_error>(floats, ints);
+
+        Containers::LinkedList<unsigned> unsignedInts{7u};
+        checkRejected<std::runtime_error>(unsignedInts, ints);
+
+        Containers::LinkedList<std::int64_t> longs{8};
+        checkRejected<std::runtime_error>(longs, serialize(Containers::LinkedList<double>{1.0}));
+
+        // Файл без записанного вида элемента (сохраненный до появления этого поля) проверяется только по размеру.
+        const std::string legacy = withHeader(ints, [](ListFileHeader& header) { header.elementKind = 0; });
+        Containers::LinkedList<int> loaded;
+        std::istringstream in(legacy, std::ios::binary);
+        loaded.loadFrom(in);
+        CHECK(loaded.size() == 3 && loaded.front() == 1 && loaded.back() == 3);
+    }
+
+    // Испорченный заголовок или счетчик отклоняется, а список не изменяется.
+    void corruptHeaderLeavesListUnchanged()
+    {
+        const std::string data = serialize(Containers::LinkedList<int>{1, 2, 3});
+        Containers::LinkedList<int> list{10, 20};
+
+        checkRejected<std::runtime_error>(list, withHeader(data, [](ListFileHeader& header) { header.magic[0] = 'X'; }));
+        checkRejected<std::runtime_error>(list, withHeader(data, [](ListFileHeader& header) { header.version = 99; }));
+        checkRejected<std::runtime_error>(list, withHeader(data, [](ListFileHeader& header) { header.byteOrder = 0x04030201; }));
+        checkRejected<std::runtime_error>(list, withHeader(data, [](ListFileHeader& header) { header.elementSize = 8; }));
+        checkRejected<std::runtime_error>(list, withHeader(data, [](ListFileHeader& header) { header.count = 4; }));
+        checkRejected<std::runtime_error>(list, withHeader(data, [](ListFileHeader& header) { header.count = ~std::uint64_t(0); }));
+        checkRejected<std::runtime_error>(list, data.substr(0, sizeof(ListFileHeader) / 2));
+
+        Containers::LinkedList<std::string> strings{"kept"};
+        const std::string stringData = serialize(Containers::LinkedList<std::string>{"a", "b"});
+        checkRejected<std::runtime_error>(strings, withHeader(stringData, [](ListFileHeader& header) { header.count = 1000; }));
+        checkRejected<std::runtime_error>(strings, data);
+
+        CHECK(list.size() == 2 && list.front() == 10 && list.back() == 20);
+        CHECK(strings.size() == 1 && strings.front() == "kept");
+    }
+
+#ifdef CONTAINERS_HAS_MMAP
+    // MappedListView открывает файл только с тем же типом элементов.
+    void mappedViewChecksElementType()
+    {
+        const std::string path = (std::filesystem::temp_directory_path() / "list_serialization_tests.bin").string();
+        Containers::LinkedList<int>{1, 2, 3}.saveTo(path);
+
+        Containers::MappedListView<int> view(path);
+        CHECK(view.size() == 3 && view.front() == 1 && view.back() == 3);
+
+        try
+        {
+            Containers::MappedListView<float> floats(path);
+            CHECK(false);
+        }
+        catch (const std::runtime_error&) {}
+
+        std::error_code ignored;
+        std::filesystem::remove(path, ignored);
+    }
+#endif
+}
+
+int main()
+{
+    roundTrip();
+    otherElementTypeIsRejected();
+    corruptHeaderLeavesListUnchanged();
+#ifdef CONTAINERS_HAS_MMAP
+    mappedViewChecksElementType();
+#endif
+
+    return tests::testExitCode("list_serialization_tests");
+}
@@ -0,0 +1,186 @@
+/*  list_stats_tests.cpp - проверка того, что каждая операция LinkedList учитывается в статистике ровно один раз
+    и под своим именем (в том числе когда она удаляет или вставляет элемент на конце списка).
+    Сборка и запуск из корня репозитория:
+        g++ -std=c++17 -O2 -pthread tests/list_stats_tests.cpp -o list_stats_tests
+        ./list_stats_tests  */
+#include "check.hpp"
+#include "../dream.cpp"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <stdexcept>
+
+namespace
+{
+    using Containers::ListOperation;
+    using Containers::ListStatsSnapshot;
+
+    constexpr size_t operationCount = ListStatsSnapshot::operationCount;
+
+    // Метод возвращает, на сколько выросло количество вызовов каждой операции между снимками before и after.
+    std::array<std::uint64_t, operationCount> callsBetween(const ListStatsSnapshot& before, const ListStatsSnapshot& after)
+    {
+        std::array<std::uint64_t, operationCount> calls{};
+
+        for (size_t i = 0; i < operationCount; ++i) {
+            calls[i] = after.operations[i].calls - before.operations[i].calls;
+        }
+
+        return calls;
+    }
+
+    // Метод проверяет, что между снимками вызывалась только операция operation и ровно count раз.
+    void checkOnly(const ListStatsSnapshot& before, const ListStatsSnapshot& after, ListOperation operation, std::uint64_t count)
+    {
+        const std::array<std::uint64_t, operationCount> calls = callsBetween(before, after);
+
+        for (size_t i = 0; i < operationCount; ++i) {
+            CHECK(calls[i] == (i == static_cast<size_t>(operation) ? count : 0));
+        }
+
+        if (after.hasLatency)
+        {
+            for (size_t i = 0; i < operationCount; ++i) {
+                CHECK(after.operations[i].latencyCount - before.operations[i].latencyCount == calls[i]);
+            }
+        }
+    }
+
+    template <typename List>
+    ListStatsSnapshot snapshotOf(const List& list) {
+        return list.getStats().snapshot();
+    }
+
+    // remove() первого, среднего и последнего элемента - это только вызовы remove.
+    template <typename List>
+    void removeIsCountedOnce()
+    {
+        List list{1, 2, 3, 4, 5};
+        const ListStatsSnapshot before = snapshotOf(list);
+
+        CHECK(list.remove(1));
+        CHECK(list.remove(3));
+        CHECK(list.remove(5));
+        CHECK(!list.remove(42));
+
+        const ListStatsSnapshot after = snapshotOf(list);
+        checkOnly(before, after, ListOperation::Remove, 4);
+        CHECK(after.deallocations - before.deallocations == 3);
+        CHECK(list.size() == 2);
+        CHECK(list.front() == 2 && list.back() == 4);
+    }
+
+    // insertAt() в начало, в середину и в конец - это только вызовы insert.
+    template <typename List>
+    void insertAtIsCountedOnce()
+    {
+        List list{2, 4};
+        const ListStatsSnapshot before = snapshotOf(list);
+
+        list.insertAt(0, 1);
+        list.insertAt(2, 3);
+        list.insertAt(list.size(), 5);
+        list.emplaceAt(1, 10);
+
+        const ListStatsSnapshot after = snapshotOf(list);
+        checkOnly(before, after, ListOperation::Insert, 4);
+        CHECK(after.allocations - before.allocations == 4);
+
+        // Поиск позиции учитывается в статистике insert, а не operator[].
+        CHECK(after[ListOperation::Insert].nodesTraversed > before[ListOperation::Insert].nodesTraversed);
+        CHECK(after[ListOperation::Index].nodesTraversed == before[ListOperation::Index].nodesTraversed);
+
+        const int expected[] = {1, 10, 2, 3, 4, 5};
+        CHECK(std::equal(list.begin(), list.end(), std::begin(expected), std::end(expected)));
+    }
+
+    // eraseAt() первого, среднего и последнего элемента - это только вызовы erase.
+    template <typename List>
+    void eraseAtIsCountedOnce()
+    {
+        List list{1, 2, 3, 4, 5};
+        const ListStatsSnapshot before = snapshotOf(list);
+
+        CHECK(list.eraseAt(0) == 1);
+        CHECK(list.eraseAt(1) == 3);
+        CHECK(list.eraseAt(list.size() - 1) == 5);
+
+        const ListStatsSnapshot after = snapshotOf(list);
+        checkOnly(before, after, ListOperation::Erase, 3);
+        CHECK(after.deallocations - before.deallocations == 3);
+        CHECK(list.size() == 2);
+        CHECK(list.front() == 2 && list.back() == 4);
+    }
+
+    // Операции с концами списка по-прежнему учитываются под своими именами.
+    template <typename List>
+    void endOperationsAreCountedOnce()
+    {
+        List list;
+        ListStatsSnapshot before = snapshotOf(list);
+
+        list.pushFront(1);
+        list.emplaceFront(0);
+        checkOnly(before, snapshotOf(list), ListOperation::PushFront, 2);
+
+        before = snapshotOf(list);
+        list.pushBack(2);
+        list.emplaceBack(3);
+        checkOnly(before, snapshotOf(list), ListOperation::PushBack, 2);
+
+        before = snapshotOf(list);
+        CHECK(list.popFront() == 0);
+        checkOnly(before, snapshotOf(list), ListOperation::PopFront, 1);
+
+        before = snapshotOf(list);
+        CHECK(list.popBack() == 3);
+        checkOnly(before, snapshotOf(list), ListOperation::PopBack, 1);
+    }
+
+    // Неудачные вызовы (индекс вне диапазона) тоже учитываются один раз.
+    template <typename List>
+    void failedCallsAreCountedOnce()
+    {
+        List list{1};
+        ListStatsSnapshot before = snapshotOf(list);
+
+        try
+        {
+            list.eraseAt(5);
+            CHECK(false);
+        }
+        catch (const std::out_of_range&) {}
+
+        checkOnly(before, snapshotOf(list), ListOperation::Erase, 1);
+
+        before = snapshotOf(list);
+
+        try
+        {
+            list.insertAt(5, 2);
+            CHECK(false);
+        }
+        catch (const std::out_of_range&) {}
+
+        checkOnly(before, snapshotOf(list), ListOperation::Insert, 1);
+    }
+
+    template <typename List>
+    void runAll()
+    {
+        removeIsCountedOnce<List>();
+        insertAtIsCountedOnce<List>();
+        eraseAtIsCountedOnce<List>();
+        endOperationsAreCountedOnce<List>();
+        failedCallsAreCountedOnce<List>();
+    }
+}
+
+int main()
+{
+    runAll<Containers::LinkedList<int, std::allocator<int>, Containers::ListStats<>>>();
+    runAll<Containers::LinkedList<int, std::allocator<int>, Containers::ListStats<true>>>();
+
+    return tests::testExitCode("list_stats_tests");
+}
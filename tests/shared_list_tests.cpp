@@ -0,0 +1,327 @@
+/*  shared_list_tests.cpp - тесты SharedLinkedList.
+    1.  Copy-on-write: изменение одной из копий (set, remove, removeAll, popBack, pushBack, popFront)
+    не видно в других копиях, а неизмененный хвост остается общим.
+    2.  pushFront() и popFront() на разделяемом списке не копируют узлы: копия ссылается на общий хвост.
+    3.  Конкурентная нагрузка: владелец изменяет список и публикует снимки, а читатели в других потоках
+    копируют снимки, обходят и изменяют свои копии и уничтожают их (последним владельцем узла
+    оказывается любой поток). Тест предназначен и для запуска под ThreadSanitizer.
+    Сборка и запуск из корня репозитория:
+        g++ -std=c++17 -O2 -pthread tests/shared_list_tests.cpp -o shared_list_tests
+        ./shared_list_tests
+    Под ThreadSanitizer:
+        g++ -std=c++17 -O1 -g -fsanitize=thread -pthread tests/shared_list_tests.cpp -o shared_list_tests_tsan
+        ./shared_list_tests_tsan  */
+#include "check.hpp"
+#include "../dream.cpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Преобразования элемента списка: число хранится как есть или в строке в куче (проверка времени жизни значений).
+    struct Plain
+    {
+        using Value = std::int64_t;
+
+        static Value make(std::int64_t key) {
+            return key;
+        }
+
+        static std::int64_t key(const Value& value) {
+            return value;
+        }
+    };
+
+    struct Boxed
+    {
+        using Value = std::string;
+
+        // Префикс делает строку длиннее буфера малой строки, поэтому значение всегда лежит в куче.
+        static Value make(std::int64_t key) {
+            return "shared-list-value-" + std::to_string(key);
+        }
+
+        static std::int64_t key(const Value& value) {
+            return std::stoll(value.substr(18));
+        }
+    };
+
+    template <typename Kind>
+    using List = Containers::SharedLinkedList<typename Kind::Value>;
+
+    // Функция возвращает ключи элементов списка по порядку.
+    template <typename Kind>
+    std::vector<std::int64_t> keysOf(const List<Kind>& list)
+    {
+        std::vector<std::int64_t> keys;
+
+        for (const typename Kind::Value& value: list) {
+            keys.push_back(Kind::key(value));
+        }
+
+        return keys;
+    }
+
+    template <typename Kind>
+    List<Kind> makeList(const std::vector<std::int64_t>& keys)
+    {
+        List<Kind> list;
+
+        for (std::int64_t key: keys) {
+            list.pushBack(Kind::make(key));
+        }
+
+        return list;
+    }
+
+    /*  Функция применяет mutate к одной из двух копий списка keys и проверяет, что изменилась только она:
+        сначала изменяется копия, затем (на новой паре) - исходный список.  */
+    template <typename Kind>
+    void checkIsolation(const std::vector<std::int64_t>& keys, const std::vector<std::int64_t>& expected,
+                        const std::function<void(List<Kind>&)>& mutate)
+    {
+        for (bool mutateCopy : {true, false})
+        {
+            List<Kind> original = makeList<Kind>(keys);
+            List<Kind> copy(original);
+
+            CHECK(original.isShared() && copy.isShared());
+
+            List<Kind>& changed = mutateCopy ? copy : original;
+            const List<Kind>& untouched = mutateCopy ? original : copy;
+
+            mutate(changed);
+
+            CHECK(keysOf<Kind>(changed) == expected);
+            CHECK(keysOf<Kind>(untouched) == keys);
+            CHECK(changed.size() == expected.size() && untouched.size() == keys.size());
+
+            // Обе копии остаются пригодными для дальнейших изменений.
+            changed.pushBack(Kind::make(100));
+            CHECK(keysOf<Kind>(untouched) == keys);
+        }
+    }
+
+    // Изменения разделяемого списка копируют только нужные узлы и не видны в других копиях.
+    template <typename Kind>
+    void copyOnWriteIsolation()
+    {
+        const std::vector<std::int64_t> keys{1, 2, 3, 2, 4, 2};
+
+        checkIsolation<Kind>(keys, {1, 2, 9, 2, 4, 2}, [](List<Kind>& list) { list.set(2, Kind::make(9)); });
+        checkIsolation<Kind>(keys, {1, 2, 3, 2, 4, 9}, [](List<Kind>& list) { list.set(-1, Kind::make(9)); });
+        checkIsolation<Kind>(keys, {1, 3, 2, 4, 2}, [](List<Kind>& list) { CHECK(list.remove(Kind::make(2))); });
+        checkIsolation<Kind>(keys, {2, 3, 2, 4, 2}, [](List<Kind>& list) { CHECK(list.remove(Kind::make(1))); });
+        checkIsolation<Kind>(keys, {1, 3, 4}, [](List<Kind>& list) { CHECK(list.removeAll(Kind::make(2))); });
+        checkIsolation<Kind>(keys, {1, 2, 3, 2, 4}, [](List<Kind>& list) { CHECK(Kind::key(list.popBack()) == 2); });
+        checkIsolation<Kind>(keys, {2, 3, 2, 4, 2}, [](List<Kind>& list) { CHECK(Kind::key(list.popFront()) == 1); });
+        checkIsolation<Kind>(keys, {1, 2, 3, 2, 4, 2, 5}, [](List<Kind>& list) { list.pushBack(Kind::make(5)); });
+        checkIsolation<Kind>(keys, {}, [](List<Kind>& list) { list.clear(); });
+
+        // Неудачные изменения тоже ничего не меняют.
+        checkIsolation<Kind>(keys, keys, [](List<Kind>& list) {
+            CHECK(!list.remove(Kind::make(42)));
+            CHECK(!list.removeAll(Kind::make(42)));
+        });
+
+        // Изменение последнего элемента копирует весь разделяемый участок, после чего список снова не разделен.
+        List<Kind> original = makeList<Kind>(keys);
+        List<Kind> copy(original);
+        copy.set(-1, Kind::make(7));
+        CHECK(!copy.isShared());
+        CHECK(&copy.front() != &original.front());
+    }
+
+    // pushFront() и popFront() на разделяемом списке не копируют узлы: хвост остается общим.
+    template <typename Kind>
+    void tailIsSharedAfterPushFront()
+    {
+        List<Kind> original = makeList<Kind>({1, 2, 3});
+        List<Kind> copy(original);
+
+        copy.pushFront(Kind::make(0));
+        CHECK(keysOf<Kind>(copy) == std::vector<std::int64_t>({0, 1, 2, 3}));
+        CHECK(keysOf<Kind>(original) == std::vector<std::int64_t>({1, 2, 3}));
+        CHECK(&copy[1] == &original[0] && &copy.back() == &original.back());
+
+        original.pushFront(Kind::make(9));
+        CHECK(keysOf<Kind>(copy) == std::vector<std::int64_t>({0, 1, 2, 3}));
+        CHECK(&copy[1] == &original[1]);
+
+        List<Kind> tail(original);
+        CHECK(Kind::key(tail.popFront()) == 9);
+        CHECK(&tail.front() == &original[1] && &tail.front() == &copy[1]);
+        CHECK(original.size() == 4 && tail.size() == 3);
+
+        // Изменение общего хвоста в одной копии копирует его только в ней.
+        tail.set(0, Kind::make(5));
+        CHECK(keysOf<Kind>(tail) == std::vector<std::int64_t>({5, 2, 3}));
+        CHECK(keysOf<Kind>(original) == std::vector<std::int64_t>({9, 1, 2, 3}));
+        CHECK(keysOf<Kind>(copy) == std::vector<std::int64_t>({0, 1, 2, 3}));
+        CHECK(&original[2] == &copy[2]);
+    }
+
+    // Снимок - копия списка владельца и ожидаемые размер и сумма ключей.
+    template <typename Kind>
+    struct Snapshot
+    {
+        List<Kind> list;
+        size_t size = 0;
+        std::int64_t sum = 0;
+    };
+
+    template <typename Kind>
+    std::int64_t sumOf(const List<Kind>& list)
+    {
+        std::int64_t sum = 0;
+
+        for (const typename Kind::Value& value: list) {
+            sum += Kind::key(value);
+        }
+
+        return sum;
+    }
+
+    /*  Владелец изменяет список и публикует его копии, читатели копируют опубликованный снимок
+        (копирование одного объекта из нескольких потоков допустимо), проверяют и изменяют свои копии.  */
+    template <typename Kind>
+    void concurrentSnapshots(size_t readerCount, size_t rounds)
+    {
+        std::mutex publishedMutex;
+        Snapshot<Kind> published;
+        std::atomic<bool> done{false};
+        std::atomic<size_t> snapshotsRead{0};
+
+        std::vector<std::thread> readers;
+
+        for (size_t r = 0; r < readerCount; ++r)
+        {
+            readers.emplace_back([&, r]()
+            {
+                std::mt19937 generator(unsigned(r) + 1);
+                std::vector<Snapshot<Kind>> held;
+
+                while (!done.load(std::memory_order_acquire))
+                {
+                    Snapshot<Kind> snapshot;
+
+                    {
+                        std::lock_guard<std::mutex> lock(publishedMutex);
+                        snapshot = published;
+                    }
+
+                    // Снимок не меняется, пока владелец изменяет свой список.
+                    CHECK(snapshot.list.size() == snapshot.size);
+                    CHECK(sumOf<Kind>(snapshot.list) == snapshot.sum);
+                    CHECK(size_t(std::distance(snapshot.list.begin(), snapshot.list.end())) == snapshot.size);
+
+                    // Копия снимка изменяется в потоке читателя и не влияет на сам снимок.
+                    List<Kind> local(snapshot.list);
+                    local.pushBack(Kind::make(1000));
+
+                    if (!local.isEmpty()) {
+                        local.set(0, Kind::make(-1));
+                    }
+
+                    CHECK(sumOf<Kind>(snapshot.list) == snapshot.sum);
+
+                    // Часть снимков удерживается дольше, чтобы их узлы освобождались в разных потоках.
+                    held.push_back(std::move(snapshot));
+
+                    if (held.size() > 4) {
+                        held.erase(held.begin() + std::ptrdiff_t(generator() % held.size()));
+                    }
+
+                    snapshotsRead.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        std::mt19937 generator(42);
+        List<Kind> owner;
+        std::vector<List<Kind>> ownerSnapshots;
+
+        // Владелец работает не меньше rounds раундов и, пока каждый читатель в среднем не прочитал 100 снимков.
+        for (size_t round = 0; round < rounds || snapshotsRead.load(std::memory_order_relaxed) < readerCount * 100; ++round)
+        {
+            // 1. Изменяю список владельца (он разделяет узлы с опубликованными снимками).
+            const std::int64_t key = std::int64_t(generator() % 64);
+
+            switch (generator() % 7)
+            {
+                case 0: owner.pushBack(Kind::make(key)); break;
+                case 1: owner.pushFront(Kind::make(key)); break;
+                case 2: owner.remove(Kind::make(key)); break;
+                case 3: owner.removeAll(Kind::make(key)); break;
+
+                case 4:
+                    if (!owner.isEmpty()) {
+                        owner.set(int(generator() % owner.size()), Kind::make(key));
+                    }
+                    break;
+
+                case 5:
+                    if (owner.size() > 32) {
+                        owner.popBack();
+                    }
+                    break;
+
+                default:
+                    if (owner.size() > 32) {
+                        owner.popFront();
+                    }
+                    break;
+            }
+
+            // 2. Время от времени публикую копию, а старые копии владельца уничтожаю.
+            if (round % 8 == 0)
+            {
+                Snapshot<Kind> next{owner, owner.size(), sumOf<Kind>(owner)};
+
+                {
+                    std::lock_guard<std::mutex> lock(publishedMutex);
+                    std::swap(published, next);
+                }
+
+                ownerSnapshots.push_back(owner);
+
+                if (ownerSnapshots.size() > 3) {
+                    ownerSnapshots.erase(ownerSnapshots.begin());
+                }
+            }
+        }
+
+        done.store(true, std::memory_order_release);
+
+        for (std::thread& reader: readers) {
+            reader.join();
+        }
+
+        CHECK(snapshotsRead.load() >= readerCount * 100);
+        CHECK(size_t(std::distance(owner.begin(), owner.end())) == owner.size());
+    }
+
+    template <typename Kind>
+    void runAll()
+    {
+        copyOnWriteIsolation<Kind>();
+        tailIsSharedAfterPushFront<Kind>();
+        concurrentSnapshots<Kind>(4, 20000);
+    }
+}
+
+int main()
+{
+    runAll<Plain>();
+    runAll<Boxed>();
+
+    return tests::testExitCode("shared_list_tests");
+}
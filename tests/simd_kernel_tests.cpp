@@ -0,0 +1,308 @@
+/*  simd_kernel_tests.cpp - дифференциальная проверка векторных ядер поиска (simd) против скалярных.
+    1.  Ядра find / count на каждом уровне simd::setMaxLevel() (Scalar, SSE2, AVX2 - насколько их поддерживает
+    процессор) сверяются со скалярными на массивах всех длин до нескольких векторов и с разным смещением
+    начала, в том числе с хвостом короче вектора (окно, выровненное по концу массива).
+    2.  Значения подобраны так, чтобы ловить ошибки дорожек: числа, отличающиеся только старшими байтами,
+    NaN (не равен ничему, в том числе себе) и -0.0 (равен 0.0).
+    3.  find / count / remove / removeAll у UnrolledLinkedList с емкостью узла, не кратной ширине вектора,
+    сверяются с теми же операциями над std::vector.
+    Массивы копируются в память точного размера, поэтому под AddressSanitizer видно и чтение за их границей.
+    Сборка и запуск из корня репозитория:
+        g++ -std=c++17 -O2 -pthread tests/simd_kernel_tests.cpp -o simd_kernel_tests
+        ./simd_kernel_tests  */
+#include "check.hpp"
+#include "../dream.cpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Containers::simd::Level;
+
+    constexpr Level levels[] = {Level::Scalar, Level::SSE2, Level::AVX2};
+
+    // Функция возвращает набор значений, из которых составляются массивы (и которые ищутся).
+    template <typename T>
+    std::vector<T> alphabet()
+    {
+        std::vector<T> values{T(0), T(1), T(2), T(3)};
+
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            values.push_back(-T(0));
+            values.push_back(std::numeric_limits<T>::quiet_NaN());
+            values.push_back(-std::numeric_limits<T>::infinity());
+            values.push_back(T(0.5));
+        }
+        else
+        {
+            // Значения, совпадающие с другими в младших байтах, и значение из одних единичных битов.
+            values.push_back(T(~T(0)));
+
+            if constexpr (sizeof(T) >= 2) {
+                values.push_back(T(T(1) << (sizeof(T) * 8 - 8)));
+            }
+
+            if constexpr (sizeof(T) == 8) {
+                values.push_back(T(std::int64_t(1) << 32));
+                values.push_back(T((std::int64_t(1) << 32) | 1));
+            }
+        }
+
+        return values;
+    }
+
+    // Функция сравнивает значения побитово (NaN равен NaN с теми же битами, -0.0 отличается от 0.0).
+    template <typename T>
+    bool sameBits(const T& first, const T& second) {
+        return std::memcmp(&first, &second, sizeof(T)) == 0;
+    }
+
+    template <typename T>
+    bool sameBits(const std::vector<T>& first, const std::vector<T>& second)
+    {
+        return first.size() == second.size() &&
+               std::equal(first.begin(), first.end(), second.begin(), [](const T& a, const T& b) { return sameBits(a, b); });
+    }
+
+    // Ядра find и count каждого уровня совпадают со скалярными на всех длинах, смещениях и искомых значениях.
+    template <typename T>
+    void kernelsMatchScalar()
+    {
+        using namespace Containers::simd;
+
+        const std::vector<T> values = alphabet<T>();
+        std::mt19937 generator{unsigned(sizeof(T) * 7 + std::is_floating_point_v<T>)};
+
+        // Три вектора AVX2 и еще несколько значений - чтобы пройти полные векторы и все варианты хвоста.
+        const size_t maxCount = 3 * 32 / sizeof(T) + 5;
+
+        for (Level level : levels)
+        {
+            setMaxLevel(level);
+            const FindKernel<T> findIn = findKernel<T>();
+            const CountKernel<T> countIn = countKernel<T>();
+
+            for (size_t count = 0; count <= maxCount; ++count)
+            {
+                for (size_t round = 0; round < 4; ++round)
+                {
+                    // Массив из count значений в памяти точного размера (смещение начала задает malloc).
+                    std::unique_ptr<T[]> data(new T[count == 0 ? 1 : count]);
+
+                    for (size_t i = 0; i < count; ++i) {
+                        data[i] = values[generator() % (round == 0 ? 2 : values.size())];
+                    }
+
+                    for (const T& needle : values)
+                    {
+                        // Поиск по всему массиву и по его суффиксу (невыровненное начало).
+                        for (size_t offset : {size_t(0), size_t(1)})
+                        {
+                            if (offset > count) {
+                                continue;
+                            }
+
+                            const T* start = data.get() + offset;
+                            const size_t length = count - offset;
+
+                            CHECK(findIn(start, length, needle) == findScalar(start, length, needle));
+                            CHECK(countIn(start, length, needle) == countScalar(start, length, needle));
+                        }
+                    }
+                }
+            }
+        }
+
+        setMaxLevel(Level::AVX2);
+    }
+
+    // Совпадение в последнем значении и в значении, уже проверенном окном хвоста, находится ровно один раз.
+    template <typename T>
+    void tailWindowCountsOnce()
+    {
+        using namespace Containers::simd;
+
+        for (Level level : levels)
+        {
+            setMaxLevel(level);
+
+            for (size_t count = 1; count <= 2 * 32 / sizeof(T) + 3; ++count)
+            {
+                std::vector<T> data(count, T(1));
+
+                for (size_t match = 0; match < count; ++match)
+                {
+                    data[match] = T(2);
+                    CHECK(findKernel<T>()(data.data(), count, T(2)) == match);
+                    CHECK(countKernel<T>()(data.data(), count, T(2)) == 1);
+                    CHECK(countKernel<T>()(data.data(), count, T(1)) == count - 1);
+                    data[match] = T(1);
+                }
+            }
+        }
+
+        setMaxLevel(Level::AVX2);
+    }
+
+    // NaN не находится никогда, -0.0 и 0.0 находят друг друга (как оператор ==).
+    template <typename T>
+    void floatingPointSemantics()
+    {
+        using namespace Containers::simd;
+
+        const T nan = std::numeric_limits<T>::quiet_NaN();
+        std::vector<T> data(3 * 32 / sizeof(T) + 1, T(1));
+        data[5] = nan;
+        data[7] = -T(0);
+        data.back() = T(0);
+
+        for (Level level : levels)
+        {
+            setMaxLevel(level);
+
+            CHECK(findKernel<T>()(data.data(), data.size(), nan) == data.size());
+            CHECK(countKernel<T>()(data.data(), data.size(), nan) == 0);
+            CHECK(findKernel<T>()(data.data(), data.size(), T(0)) == 7);
+            CHECK(findKernel<T>()(data.data(), data.size(), -T(0)) == 7);
+            CHECK(countKernel<T>()(data.data(), data.size(), T(0)) == 2);
+        }
+
+        setMaxLevel(Level::AVX2);
+    }
+
+    // Метод возвращает содержимое списка в виде массива.
+    template <typename List>
+    auto valuesOf(const List& list)
+    {
+        return std::vector<typename List::value_type>(list.begin(), list.end());
+    }
+
+    // Метод возвращает номер элемента, на который указывает found (или размер списка для nullptr).
+    template <typename List, typename T>
+    size_t positionOf(const List& list, const T* found)
+    {
+        size_t position = 0;
+
+        for (auto it = list.begin(); it != list.end() && &*it != found; ++it) {
+            ++position;
+        }
+
+        return position;
+    }
+
+    /*  find / count / remove / removeAll у UnrolledLinkedList с узлами по NodeBytes байт на каждом уровне
+        совпадают с теми же операциями над std::vector (оператор ==).  */
+    template <typename T, size_t NodeBytes>
+    void unrolledListMatchesVector()
+    {
+        using namespace Containers::simd;
+        using List = Containers::UnrolledLinkedList<T, std::allocator<T>, NodeBytes>;
+
+        const std::vector<T> values = alphabet<T>();
+
+        for (Level level : levels)
+        {
+            setMaxLevel(level);
+            std::mt19937 generator{unsigned(NodeBytes + sizeof(T))};
+
+            for (size_t round = 0; round < 6; ++round)
+            {
+                // Список заполняется с обоих концов, поэтому занятые отрезки узлов начинаются с разных ячеек.
+                List list;
+                std::vector<T> reference;
+                const size_t size = generator() % (4 * List::nodeCapacity + 3);
+
+                for (size_t i = 0; i < size; ++i)
+                {
+                    const T value = values[generator() % values.size()];
+
+                    if (generator() % 3 == 0)
+                    {
+                        list.pushFront(value);
+                        reference.insert(reference.begin(), value);
+                    }
+                    else
+                    {
+                        list.pushBack(value);
+                        reference.push_back(value);
+                    }
+                }
+
+                for (const T& needle : values)
+                {
+                    const auto match = std::find(reference.begin(), reference.end(), needle);
+
+                    CHECK(positionOf(list, list.find(needle)) == size_t(match - reference.begin()));
+                    CHECK(list.contains(needle) == (match != reference.end()));
+                    CHECK(list.count(needle) == size_t(std::count(reference.begin(), reference.end(), needle)));
+                }
+
+                // remove и removeAll изменяют список так же, как эталон.
+                for (size_t step = 0; step < values.size(); ++step)
+                {
+                    const T& needle = values[generator() % values.size()];
+
+                    if (step % 2 == 0)
+                    {
+                        const auto match = std::find(reference.begin(), reference.end(), needle);
+                        const bool found = match != reference.end();
+
+                        if (found) {
+                            reference.erase(match);
+                        }
+
+                        CHECK(list.remove(needle) == found);
+                    }
+                    else
+                    {
+                        const size_t before = reference.size();
+                        reference.erase(std::remove(reference.begin(), reference.end(), needle), reference.end());
+
+                        CHECK(list.removeAll(needle) == (reference.size() != before));
+                    }
+
+                    CHECK(list.size() == reference.size());
+                    CHECK(sameBits(valuesOf(list), reference));
+                }
+            }
+        }
+
+        setMaxLevel(Level::AVX2);
+    }
+
+    template <typename T>
+    void runAll()
+    {
+        kernelsMatchScalar<T>();
+        tailWindowCountsOnce<T>();
+
+        if constexpr (std::is_floating_point_v<T>) {
+            floatingPointSemantics<T>();
+        }
+
+        // Емкости узлов не кратны ширине векторов (и для 128 байт, и для 100, и для 520).
+        unrolledListMatchesVector<T, 100>();
+        unrolledListMatchesVector<T, 128>();
+        unrolledListMatchesVector<T, 520>();
+    }
+}
+
+int main()
+{
+    runAll<std::int8_t>();
+    runAll<std::uint16_t>();
+    runAll<int>();
+    runAll<std::int64_t>();
+    runAll<float>();
+    runAll<double>();
+
+    return tests::testExitCode("simd_kernel_tests");
+}